@@ -24,26 +24,49 @@
 #define IKSDL_IKSDL_HPP
 
 #include "iksdl/AbstractEvent.hpp"
+#include "iksdl/AnimationSet.hpp"
+#include "iksdl/AssetManifest.hpp"
+#include "iksdl/AssetPreloader.hpp"
+#include "iksdl/AudioDevice.hpp"
+#include "iksdl/AudioDeviceOptions.hpp"
+#include "iksdl/AudioEmitter.hpp"
+#include "iksdl/AudioLoader.hpp"
+#include "iksdl/AudioScene.hpp"
+#include "iksdl/AudioSceneOptions.hpp"
 #include "iksdl/Color.hpp"
 #include "iksdl/Drawable.hpp"
 #include "iksdl/Event.hpp"
+#include "iksdl/EventCoalescing.hpp"
+#include "iksdl/EventDispatch.hpp"
 #include "iksdl/EventHandler.hpp"
+#include "iksdl/EventRecorder.hpp"
+#include "iksdl/EventReplay.hpp"
 #include "iksdl/EventSupport.hpp"
 #include "iksdl/FillRectangle.hpp"
 #include "iksdl/FillRectangleArray.hpp"
 #include "iksdl/FillRectangleArrayf.hpp"
 #include "iksdl/FillRectanglef.hpp"
 #include "iksdl/Font.hpp"
+#include "iksdl/GameLoop.hpp"
+#include "iksdl/GameLoopOptions.hpp"
+#include "iksdl/InputBindings.hpp"
+#include "iksdl/InputChord.hpp"
+#include "iksdl/InputState.hpp"
 #include "iksdl/InvalidParameterException.hpp"
+#include "iksdl/Job.hpp"
+#include "iksdl/JobSystem.hpp"
+#include "iksdl/JobSystemOptions.hpp"
 #include "iksdl/Keyboard.hpp"
 #include "iksdl/KeyboardEvent.hpp"
 #include "iksdl/Line.hpp"
 #include "iksdl/LineArray.hpp"
+#include "iksdl/MixingEngine.hpp"
 #include "iksdl/Mouse.hpp"
 #include "iksdl/MouseButtonEvent.hpp"
 #include "iksdl/MouseMotionEvent.hpp"
 #include "iksdl/MouseWheelEvent.hpp"
 #include "iksdl/Music.hpp"
+#include "iksdl/ParticleSystem.hpp"
 #include "iksdl/Point.hpp"
 #include "iksdl/PointArray.hpp"
 #include "iksdl/Position.hpp"
@@ -53,16 +76,26 @@
 #include "iksdl/RectangleArray.hpp"
 #include "iksdl/RectangleArrayf.hpp"
 #include "iksdl/Rectanglef.hpp"
+#include "iksdl/RenderCommandList.hpp"
+#include "iksdl/RenderQueue.hpp"
 #include "iksdl/Renderer.hpp"
 #include "iksdl/RendererOptions.hpp"
 #include "iksdl/SdlException.hpp"
 #include "iksdl/Size.hpp"
 #include "iksdl/Sound.hpp"
+#include "iksdl/SoundBank.hpp"
+#include "iksdl/SoundPolicy.hpp"
 #include "iksdl/Sprite.hpp"
+#include "iksdl/SpriteSheet.hpp"
 #include "iksdl/Spritef.hpp"
+#include "iksdl/Subsystems.hpp"
 #include "iksdl/Text.hpp"
 #include "iksdl/Textf.hpp"
 #include "iksdl/Texture.hpp"
+#include "iksdl/TileMap.hpp"
+#include "iksdl/UserEvent.hpp"
+#include "iksdl/Voice.hpp"
+#include "iksdl/VoiceManager.hpp"
 #include "iksdl/Window.hpp"
 #include "iksdl/WindowEvent.hpp"
 #include "iksdl/WindowOptions.hpp"
@@ -39,6 +39,8 @@ namespace iksdl
 /////////////////////////////////////////////////
 class AbstractRectangle : public Drawable
 {
+    friend class RenderCommandList;
+
     public:
 
         /////////////////////////////////////////////////
@@ -46,6 +46,8 @@ namespace iksdl
 /////////////////////////////////////////////////
 class AbstractRectangleArray : public Drawable
 {
+    friend class RenderCommandList;
+
     public:
 
         /////////////////////////////////////////////////
@@ -46,6 +46,8 @@ namespace iksdl
 /////////////////////////////////////////////////
 class AbstractRectangleArrayf : public Drawable
 {
+    friend class RenderCommandList;
+
     public:
 
         /////////////////////////////////////////////////
@@ -39,6 +39,8 @@ namespace iksdl
 /////////////////////////////////////////////////
 class AbstractRectanglef : public Drawable
 {
+    friend class RenderCommandList;
+
     public:
 
         /////////////////////////////////////////////////
@@ -0,0 +1,213 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_ANIMATION_SET_HPP
+#define IKSDL_ANIMATION_SET_HPP
+
+#include "iksdl/Drawable.hpp"
+#include "iksdl/Position.hpp"
+#include "iksdl/Size.hpp"
+#include "iksdl/SpriteSheet.hpp"
+#include "iksdl/iksdl_export.hpp"
+#include <SDL.h>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace iksdl
+{
+
+/////////////////////////////////////////////////
+/// \brief Many animated sprites sharing a sprite sheet
+///
+/// This is the recommended approach when animating many sprites.
+/// All the instances are advanced in a single loop over contiguous
+/// arrays, and their frames are written straight into one vertex
+/// buffer, which is drawn with a single call.
+///
+/// The instances are identified by their index. Removing an instance
+/// moves the last one to its index.
+///
+/// The sprite sheet must not be destroyed while a set is using it.
+///
+/// \see SpriteSheet
+/////////////////////////////////////////////////
+class AnimationSet : public Drawable
+{
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Constructor for a set without instances
+        ///
+        /// \param sheet Sprite sheet containing the frames and animations
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT explicit AnimationSet(const SpriteSheet& sheet);
+
+        /////////////////////////////////////////////////
+        /// \brief Add an instance playing an animation from its start
+        ///
+        /// This method will throw \a InvalidParameterException if
+        /// the sheet has no such animation.
+        ///
+        /// \param animation Index of the animation in the sheet
+        /// \param position  Position where the instance will be drawn (top-left corner)
+        /// \param scale     Scale applied to the size of the frames
+        ///
+        /// \return Index of the new instance
+        ///
+        /// \see SpriteSheet::getAnimation
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT size_t add(size_t animation, const Positionf& position, const Sizef& scale = Sizef(1.f, 1.f));
+
+        /////////////////////////////////////////////////
+        /// \brief Remove an instance
+        ///
+        /// The last instance takes the index of the removed one.
+        ///
+        /// This method will throw \a InvalidParameterException if
+        /// there is no such instance.
+        ///
+        /// \param index Index of the instance to remove
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void remove(size_t index);
+
+        /////////////////////////////////////////////////
+        /// \brief Remove all the instances
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void clear();
+
+        /////////////////////////////////////////////////
+        /// \brief Play an animation from its start
+        ///
+        /// This method will throw \a InvalidParameterException if
+        /// there is no such instance or if the sheet has no such
+        /// animation.
+        ///
+        /// \param index     Index of the instance
+        /// \param animation Index of the animation in the sheet
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void play(size_t index, size_t animation);
+
+        /////////////////////////////////////////////////
+        /// \brief Advance the animations of all the instances
+        ///
+        /// The instances whose animation does not loop stay on
+        /// their last frame once finished.
+        ///
+        /// \param elapsed Time elapsed since the last update
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void update(std::chrono::nanoseconds elapsed);
+
+        /////////////////////////////////////////////////
+        /// \brief Draw all the instances
+        ///
+        /// \param renderer Renderer that will handle the drawing
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT virtual void draw(SDL_Renderer* const renderer) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Change the position of an instance
+        ///
+        /// This method will throw \a InvalidParameterException if
+        /// there is no such instance.
+        ///
+        /// \param index    Index of the instance
+        /// \param position New position (top-left corner)
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void setPosition(size_t index, const Positionf& position);
+
+        /////////////////////////////////////////////////
+        /// \brief Get the position of an instance
+        ///
+        /// \param index Index of the instance
+        ///
+        /// \return Position of the instance (top-left corner)
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline Positionf getPosition(size_t index) const { return Positionf(m_positions[index].x, m_positions[index].y); }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the animation played by an instance
+        ///
+        /// \param index Index of the instance
+        ///
+        /// \return Index of the animation in the sheet
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline size_t getAnimation(size_t index) const { return m_animations[index]; }
+
+        /////////////////////////////////////////////////
+        /// \brief Has an instance finished its animation?
+        ///
+        /// Looping animations never finish.
+        ///
+        /// \param index Index of the instance
+        ///
+        /// \return True if the animation does not loop and has reached its end
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT bool isFinished(size_t index) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of instances
+        ///
+        /// \return Number of instances
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline size_t getInstancesCount() const { return m_animations.size(); }
+
+    private:
+
+        static constexpr size_t VERTICES_PER_INSTANCE = 4; ///< Corners of the quad drawing an instance
+        static constexpr size_t INDICES_PER_INSTANCE = 6;  ///< Vertices of the two triangles drawing an instance
+
+        /////////////////////////////////////////////////
+        /// \brief Throw if the sheet has no such animation
+        ///
+        /// \param animation Index of the animation in the sheet
+        /////////////////////////////////////////////////
+        void checkAnimation(size_t animation) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Throw if there is no such instance
+        ///
+        /// \param index Index of the instance
+        /////////////////////////////////////////////////
+        void checkInstance(size_t index) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Write the vertices of an instance showing a frame
+        ///
+        /// \param index Index of the instance
+        /// \param frame Index of the frame in the sheet
+        /////////////////////////////////////////////////
+        void writeFrame(size_t index, uint32_t frame);
+
+        const SpriteSheet* const m_sheet;    ///< Sprite sheet containing the frames and animations
+        std::vector<uint32_t> m_animations;  ///< Animation played by each instance
+        std::vector<uint32_t> m_steps;       ///< Current step of each instance, among all the steps of the sheet
+        std::vector<int64_t> m_times;        ///< Time since the start of the animation of each instance, in nanoseconds
+        std::vector<SDL_FPoint> m_positions; ///< Position of each instance
+        std::vector<SDL_FPoint> m_scales;    ///< Scale of each instance
+        std::vector<SDL_Vertex> m_vertices;  ///< Quads drawing the instances
+        std::vector<int> m_indices;          ///< Triangles drawing the quads
+};
+
+}
+
+#endif // IKSDL_ANIMATION_SET_HPP
@@ -0,0 +1,169 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_ASSET_MANIFEST_HPP
+#define IKSDL_ASSET_MANIFEST_HPP
+
+#include "iksdl/SoundPolicy.hpp"
+#include "iksdl/iksdl_export.hpp"
+#include <string>
+#include <vector>
+
+namespace iksdl
+{
+
+class AssetPreloader;
+
+/////////////////////////////////////////////////
+/// \brief List of the assets to load with an \a AssetPreloader
+///
+/// Each asset has a name, unique among the assets of its type,
+/// a group used to follow the loading of related assets, and
+/// a priority. The assets with the highest priority are loaded
+/// first.
+///
+/// A manifest can be written in code or read from a text file
+/// with one asset per line:
+///
+/// \code
+/// # type   name    path              group   priority  [point size]
+/// texture  hero    images/hero.png   level1  10
+/// font     title   fonts/title.ttf   menu    5         32
+/// sound    jump    sounds/jump.wav   level1  10
+/// music    theme   musics/theme.ogg  menu    0
+/// \endcode
+///
+/// \see AssetPreloader
+/////////////////////////////////////////////////
+class AssetManifest
+{
+    friend class AssetPreloader;
+
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Types of assets
+        /////////////////////////////////////////////////
+        enum class Type
+        {
+            Texture, ///< Image loaded as a \a Texture
+            Font,    ///< Font loaded as a \a Font
+            Sound,   ///< Audio file loaded as a \a Sound
+            Music    ///< Audio file loaded as a \a Music
+        };
+
+        /////////////////////////////////////////////////
+        /// \brief Read a manifest from a text file
+        ///
+        /// This method will throw \a InvalidParameterException if
+        /// the file could not be read or if a line is invalid.
+        ///
+        /// \param filePath Path to manifest file
+        ///
+        /// \return Read manifest
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static AssetManifest fromFile(const std::string& filePath);
+
+        /////////////////////////////////////////////////
+        /// \brief Add an image to load as a texture
+        ///
+        /// \param name     Name of the texture
+        /// \param filePath Path to image file
+        /// \param group    Group of the asset
+        /// \param priority Loading priority, the highest are loaded first
+        ///
+        /// \return Reference to the manifest
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT AssetManifest& addTexture(const std::string& name, const std::string& filePath,
+                                               const std::string& group = std::string(), int priority = 0);
+
+        /////////////////////////////////////////////////
+        /// \brief Add a font to load
+        ///
+        /// \param name     Name of the font
+        /// \param filePath Path to font file
+        /// \param ptSize   Point size to load font as
+        /// \param group    Group of the asset
+        /// \param priority Loading priority, the highest are loaded first
+        ///
+        /// \return Reference to the manifest
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT AssetManifest& addFont(const std::string& name, const std::string& filePath, int ptSize,
+                                            const std::string& group = std::string(), int priority = 0);
+
+        /////////////////////////////////////////////////
+        /// \brief Add a sound to load
+        ///
+        /// \param name     Name of the sound
+        /// \param filePath Path to audio file
+        /// \param group    Group of the asset
+        /// \param priority Loading priority, the highest are loaded first
+        /// \param policy   Limits applied when playing the sound
+        ///
+        /// \return Reference to the manifest
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT AssetManifest& addSound(const std::string& name, const std::string& filePath,
+                                             const std::string& group = std::string(), int priority = 0,
+                                             const SoundPolicy& policy = SoundPolicy());
+
+        /////////////////////////////////////////////////
+        /// \brief Add a music to load
+        ///
+        /// \param name     Name of the music
+        /// \param filePath Path to audio file
+        /// \param group    Group of the asset
+        /// \param priority Loading priority, the highest are loaded first
+        ///
+        /// \return Reference to the manifest
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT AssetManifest& addMusic(const std::string& name, const std::string& filePath,
+                                             const std::string& group = std::string(), int priority = 0);
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of assets in the manifest
+        ///
+        /// \return Number of assets
+        /////////////////////////////////////////////////
+        inline size_t getAssetsCount() const { return m_assets.size(); }
+
+    private:
+
+        /////////////////////////////////////////////////
+        /// \brief Asset to load
+        /////////////////////////////////////////////////
+        struct Asset
+        {
+            Type type;            ///< Type of the asset
+            std::string name;     ///< Name of the asset
+            std::string filePath; ///< Path to the file to load
+            std::string group;    ///< Group of the asset
+            int priority;         ///< Loading priority
+            int ptSize;           ///< Point size, for the fonts
+            SoundPolicy policy;   ///< Limits applied when playing, for the sounds
+        };
+
+        std::vector<Asset> m_assets; ///< Assets to load
+};
+
+}
+
+#endif // IKSDL_ASSET_MANIFEST_HPP
@@ -0,0 +1,291 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_ASSET_PRELOADER_HPP
+#define IKSDL_ASSET_PRELOADER_HPP
+
+#include "iksdl/AssetManifest.hpp"
+#include "iksdl/Font.hpp"
+#include "iksdl/Job.hpp"
+#include "iksdl/Music.hpp"
+#include "iksdl/Sound.hpp"
+#include "iksdl/Texture.hpp"
+#include "iksdl/iksdl_export.hpp"
+#include <SDL.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace iksdl
+{
+
+class Renderer;
+
+/////////////////////////////////////////////////
+/// \brief Loads the assets of manifests on background threads
+///
+/// The files are read and decoded by the worker threads of the
+/// \a JobSystem, in order of priority. The textures are then created on the main
+/// thread by \a update, as well as the fonts since SDL_ttf is not thread-safe.
+/// \a update should be called once per frame
+/// with the time it may spend, so that a loading screen keeps
+/// being drawn.
+///
+/// The loaded assets are kept by the preloader, and can be
+/// used as soon as their group is finished. The references to
+/// the assets stay valid until the preloader is destroyed.
+///
+/// All the methods must be called from the main thread.
+///
+/// \see AssetManifest, JobSystem
+/////////////////////////////////////////////////
+class AssetPreloader
+{
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Constructor
+        ///
+        /// \param renderer Renderer that will draw the textures
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT explicit AssetPreloader(const Renderer& renderer);
+
+        AssetPreloader(const AssetPreloader&) = delete;
+
+        /////////////////////////////////////////////////
+        /// \brief Destructor
+        ///
+        /// Waits for the loads in progress, the other ones are abandoned.
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT ~AssetPreloader();
+
+        AssetPreloader& operator=(const AssetPreloader&) = delete;
+
+        /////////////////////////////////////////////////
+        /// \brief Start loading the assets of a manifest
+        ///
+        /// \param manifest Assets to load
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void load(const AssetManifest& manifest);
+
+        /////////////////////////////////////////////////
+        /// \brief Load the assets of a group before the other ones
+        ///
+        /// The group gets a higher priority than all the assets
+        /// waiting to be loaded.
+        ///
+        /// \param group Group to load first
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void prioritize(const std::string& group);
+
+        /////////////////////////////////////////////////
+        /// \brief Collect the loaded assets, create the textures and open the fonts
+        ///
+        /// At least one texture or font is created by each call, so
+        /// that the loading always progresses.
+        ///
+        /// \param budget Time that can be spent creating textures and fonts
+        ///
+        /// \return Number of assets finished by this call
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT size_t update(std::chrono::nanoseconds budget = std::chrono::milliseconds(4));
+
+        /////////////////////////////////////////////////
+        /// \brief Get the part of the assets that are finished
+        ///
+        /// The assets that could not be loaded are finished too.
+        ///
+        /// \return Finished assets divided by all the assets, 1 if there are none
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT float getProgress() const;
+
+        /////////////////////////////////////////////////
+        /// \brief Get the part of the assets of a group that are finished
+        ///
+        /// \param group Group to check
+        ///
+        /// \return Finished assets divided by all the assets of the group, 1 if there are none
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT float getProgress(const std::string& group) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Are all the assets finished?
+        ///
+        /// \return True if nothing is loading anymore
+        /////////////////////////////////////////////////
+        inline bool isFinished() const { return m_finished == m_total; }
+
+        /////////////////////////////////////////////////
+        /// \brief Are all the assets of a group finished?
+        ///
+        /// \param group Group to check
+        ///
+        /// \return True if nothing of the group is loading anymore
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT bool isFinished(const std::string& group) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Get the errors of the assets that could not be loaded
+        ///
+        /// \return Error messages, in order of failure
+        /////////////////////////////////////////////////
+        inline const std::vector<std::string>& getErrors() const { return m_errors; }
+
+        /////////////////////////////////////////////////
+        /// \brief Get a loaded texture
+        ///
+        /// This method will throw \a InvalidParameterException if
+        /// there is no loaded texture with this name.
+        ///
+        /// \param name Name of the texture in the manifest
+        ///
+        /// \return Loaded texture
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT Texture& getTexture(const std::string& name);
+
+        /////////////////////////////////////////////////
+        /// \brief Get a loaded font
+        ///
+        /// This method will throw \a InvalidParameterException if
+        /// there is no loaded font with this name.
+        ///
+        /// \param name Name of the font in the manifest
+        ///
+        /// \return Loaded font
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT Font& getFont(const std::string& name);
+
+        /////////////////////////////////////////////////
+        /// \brief Get a loaded sound
+        ///
+        /// This method will throw \a InvalidParameterException if
+        /// there is no loaded sound with this name.
+        ///
+        /// \param name Name of the sound in the manifest
+        ///
+        /// \return Loaded sound
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT Sound& getSound(const std::string& name);
+
+        /////////////////////////////////////////////////
+        /// \brief Get a loaded music
+        ///
+        /// This method will throw \a InvalidParameterException if
+        /// there is no loaded music with this name.
+        ///
+        /// \param name Name of the music in the manifest
+        ///
+        /// \return Loaded music
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT Music& getMusic(const std::string& name);
+
+    private:
+
+        /////////////////////////////////////////////////
+        /// \brief Asset waiting to be loaded or created
+        /////////////////////////////////////////////////
+        struct Entry
+        {
+            AssetManifest::Asset asset; ///< Asset to load
+            size_t order;               ///< Order of submission, to keep the manifest order at equal priority
+        };
+
+        /////////////////////////////////////////////////
+        /// \brief Loaded asset: a decoded image, nothing for a font to open, the asset itself, or an error message
+        /////////////////////////////////////////////////
+        using Payload = std::variant<SDL_Surface*, std::monostate, Sound, Music, std::string>;
+
+        /////////////////////////////////////////////////
+        /// \brief Result of a load
+        /////////////////////////////////////////////////
+        struct Result
+        {
+            Entry entry;     ///< Loaded asset
+            Payload payload; ///< Content of the asset
+        };
+
+        /////////////////////////////////////////////////
+        /// \brief Number of assets of a group
+        /////////////////////////////////////////////////
+        struct GroupProgress
+        {
+            size_t total;    ///< Number of assets of the group
+            size_t finished; ///< Number of finished assets of the group
+        };
+
+        /////////////////////////////////////////////////
+        /// \brief Order the entries so that a heap gives the most important first
+        ///
+        /// \param left  First entry
+        /// \param right Second entry
+        ///
+        /// \return True if the first entry comes after the second one
+        /////////////////////////////////////////////////
+        static bool comesAfter(const Entry& left, const Entry& right);
+
+        /////////////////////////////////////////////////
+        /// \brief Load an asset, decode it for the textures, or nothing for the fonts
+        ///
+        /// \param asset Asset to load
+        ///
+        /// \return Loaded asset
+        /////////////////////////////////////////////////
+        static Payload loadAsset(const AssetManifest::Asset& asset);
+
+        /////////////////////////////////////////////////
+        /// \brief Store a finished asset
+        ///
+        /// \param entry   Finished asset
+        /// \param payload Content of the asset
+        /////////////////////////////////////////////////
+        void finish(const Entry& entry, Payload&& payload);
+
+        /////////////////////////////////////////////////
+        /// \brief Load the waiting asset with the highest priority
+        /////////////////////////////////////////////////
+        void loadNext();
+
+        const Renderer& m_renderer;                              ///< Renderer drawing the textures
+        std::vector<Job> m_jobs;                                 ///< Jobs of the loads not known to be finished
+        std::vector<Entry> m_waiting;                            ///< Heap of the assets waiting for a worker
+        std::vector<Result> m_loaded;                            ///< Assets loaded by the workers
+        std::mutex m_mutex;                                      ///< Protects the waiting and loaded assets
+        std::atomic<bool> m_stopping;                            ///< Is the preloader being destroyed?
+        std::vector<Result> m_uploads;                           ///< Heap of the decoded images waiting to be created as textures
+        size_t m_submitted;                                      ///< Number of submitted assets
+        size_t m_total;                                          ///< Number of assets to load
+        size_t m_finished;                                       ///< Number of finished assets
+        std::unordered_map<std::string, GroupProgress> m_groups; ///< Progress of each group
+        std::vector<std::string> m_errors;                       ///< Errors of the assets that could not be loaded
+        std::unordered_map<std::string, Texture> m_textures;     ///< Loaded textures
+        std::unordered_map<std::string, Font> m_fonts;           ///< Loaded fonts
+        std::unordered_map<std::string, Sound> m_sounds;         ///< Loaded sounds
+        std::unordered_map<std::string, Music> m_musics;         ///< Loaded musics
+};
+
+}
+
+#endif // IKSDL_ASSET_PRELOADER_HPP
@@ -0,0 +1,167 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_AUDIO_DEVICE_HPP
+#define IKSDL_AUDIO_DEVICE_HPP
+
+#include "iksdl/AudioDeviceOptions.hpp"
+#include "iksdl/iksdl_export.hpp"
+#include <chrono>
+#include <string_view>
+
+namespace iksdl
+{
+
+namespace priv
+{
+class Initializer;
+}
+
+/////////////////////////////////////////////////
+/// \brief Output device playing the sounds and the music
+///
+/// The device is opened with the default options by the first
+/// \a Sound or \a Music, and closed with the last one. Opening
+/// it explicitly chooses its options and keeps it opened until
+/// it is closed.
+///
+/// The device can be reopened with other options at any time.
+/// All the sounds and the music are then stopped, and the sounds
+/// must be loaded again if the sample rate, the sample format
+/// or the number of channels changed.
+///
+/// \see AudioDeviceOptions
+/////////////////////////////////////////////////
+class AudioDevice
+{
+    friend class priv::Initializer;
+
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Open the audio device, or reopen it with other options
+        ///
+        /// This method must be called from the main thread, as
+        /// the \a MixingEngine is installed again on the new device.
+        ///
+        /// This method will throw \a SdlException if the device
+        /// could not be opened.
+        ///
+        /// \param options Options of the device
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static void open(const AudioDeviceOptions& options = AudioDeviceOptions());
+
+        /////////////////////////////////////////////////
+        /// \brief Close the audio device, stopping all the sounds and the music
+        ///
+        /// If sounds or music still exist, the next one created
+        /// opens the device again with the default options.
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static void close();
+
+        /////////////////////////////////////////////////
+        /// \brief Is the audio device opened?
+        ///
+        /// \return True if the device is opened
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static bool isOpen();
+
+        /////////////////////////////////////////////////
+        /// \brief Get the sample rate actually used by the device
+        ///
+        /// \return Number of frames per second, or 0 if the device is not opened
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static int getFrequency();
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of output channels actually used by the device
+        ///
+        /// \return Number of channels, or 0 if the device is not opened
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static int getChannels();
+
+        /////////////////////////////////////////////////
+        /// \brief Get the size of the buffers actually mixed by the device
+        ///
+        /// It is measured at each mixing, so it is 0 until the first mixing.
+        ///
+        /// \return Number of frames of the last mixed buffer
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static int getBufferSize();
+
+        /////////////////////////////////////////////////
+        /// \brief Get the output latency caused by the buffer of the device
+        ///
+        /// This is the duration of the audio mixed at once, which is
+        /// the minimum delay before a played sound is heard.
+        ///
+        /// \return Duration of the last mixed buffer
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static std::chrono::nanoseconds getBufferLatency();
+
+        /////////////////////////////////////////////////
+        /// \brief Get the time between the last two mixings
+        ///
+        /// It should stay close to the buffer latency. When it is
+        /// much longer, the device probably ran out of audio.
+        ///
+        /// \return Time between the last two mixings
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static std::chrono::nanoseconds getMixingInterval();
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of underruns since the device was opened
+        ///
+        /// SDL does not report underruns, they are detected when the
+        /// mixings are more than twice the buffer latency apart.
+        ///
+        /// \return Number of detected underruns
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static unsigned int getUnderrunsCount();
+
+        /////////////////////////////////////////////////
+        /// \brief Reset the number of underruns to 0
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static void resetUnderrunsCount();
+
+    private:
+
+        /////////////////////////////////////////////////
+        /// \brief Open the closed audio device without touching the mixing engine
+        ///
+        /// This method can be called from any thread, it is used
+        /// to open the device on demand for the first sound.
+        ///
+        /// This method will throw \a SdlException if the device
+        /// could not be opened.
+        ///
+        /// \param options Options of the device
+        /////////////////////////////////////////////////
+        static void openDevice(const AudioDeviceOptions& options = AudioDeviceOptions());
+
+        static constexpr std::string_view INIT_AUDIO_ERROR = "Could not initialize audio.\nCause: ";
+        static constexpr std::string_view OPEN_DEVICE_ERROR = "Could not open audio device.\nCause: ";
+};
+
+}
+
+#endif // IKSDL_AUDIO_DEVICE_HPP
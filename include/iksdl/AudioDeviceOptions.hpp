@@ -0,0 +1,143 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_AUDIO_DEVICE_OPTIONS_HPP
+#define IKSDL_AUDIO_DEVICE_OPTIONS_HPP
+
+#include "iksdl/iksdl_export.hpp"
+
+namespace iksdl
+{
+
+class AudioDevice;
+
+/////////////////////////////////////////////////
+/// \brief Allows to set options for the audio device
+///
+/// This class works with builder methods, it is possible
+/// to chain the calls to build the full set of options
+///
+/// \see AudioDevice
+/////////////////////////////////////////////////
+class AudioDeviceOptions
+{
+    friend class AudioDevice;
+
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Trade-off between the audio latency and the CPU usage
+        ///
+        /// The smaller the buffer, the sooner a played sound is heard,
+        /// but the audio thread wakes up more often and is more likely
+        /// to miss its deadline.
+        /////////////////////////////////////////////////
+        enum class Profile
+        {
+            LowLatency, ///< Buffer of 256 frames, about 5 ms at 48 kHz
+            Balanced,   ///< Buffer of 1024 frames, about 21 ms at 48 kHz
+            PowerSaving ///< Buffer of 4096 frames, about 85 ms at 48 kHz
+        };
+
+        /////////////////////////////////////////////////
+        /// \brief Constructor from a profile
+        ///
+        /// The device is opened at 48 kHz with 16-bit stereo samples.
+        ///
+        /// \param profile Trade-off between the latency and the CPU usage
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr explicit AudioDeviceOptions(Profile profile = Profile::Balanced) :
+            m_frequency(48000),
+            m_bufferSize(bufferSizeOf(profile)),
+            m_channels(2),
+            m_floatSamples(false)
+        {}
+
+        /////////////////////////////////////////////////
+        /// \brief Set the sample rate
+        ///
+        /// The device may use a different rate if this one is not supported.
+        ///
+        /// \param frequency Number of frames per second
+        ///
+        /// \return Options with the sample rate
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr AudioDeviceOptions& frequency(int frequency) { m_frequency = frequency; return *this; }
+
+        /////////////////////////////////////////////////
+        /// \brief Set the size of the buffer of the device, overriding the profile
+        ///
+        /// \param frames Number of frames mixed at once, preferably a power of 2
+        ///
+        /// \return Options with the buffer size
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr AudioDeviceOptions& bufferSize(int frames) { m_bufferSize = frames; return *this; }
+
+        /////////////////////////////////////////////////
+        /// \brief Set the number of output channels
+        ///
+        /// \param channels 1 for mono, 2 for stereo
+        ///
+        /// \return Options with the number of channels
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr AudioDeviceOptions& channels(int channels) { m_channels = channels; return *this; }
+
+        /////////////////////////////////////////////////
+        /// \brief Use floating point samples instead of 16-bit ones
+        ///
+        /// \param enabled True to use floating point samples
+        ///
+        /// \return Options with the sample format
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr AudioDeviceOptions& floatSamples(bool enabled = true) { m_floatSamples = enabled; return *this; }
+
+    private:
+
+        /////////////////////////////////////////////////
+        /// \brief Get the buffer size of a profile
+        ///
+        /// \param profile Trade-off between the latency and the CPU usage
+        ///
+        /// \return Number of frames of the buffer
+        /////////////////////////////////////////////////
+        static constexpr int bufferSizeOf(Profile profile)
+        {
+            switch(profile)
+            {
+                case Profile::LowLatency:
+                    return 256;
+                case Profile::PowerSaving:
+                    return 4096;
+                default:
+                    return 1024;
+            }
+        }
+
+        int m_frequency;     ///< Number of frames per second
+        int m_bufferSize;    ///< Number of frames mixed at once
+        int m_channels;      ///< Number of output channels
+        bool m_floatSamples; ///< Are the samples floating point numbers?
+};
+
+}
+
+#endif // IKSDL_AUDIO_DEVICE_OPTIONS_HPP
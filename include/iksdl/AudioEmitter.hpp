@@ -0,0 +1,69 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_AUDIO_EMITTER_HPP
+#define IKSDL_AUDIO_EMITTER_HPP
+
+#include "iksdl/iksdl_export.hpp"
+#include <cstdint>
+
+namespace iksdl
+{
+
+class AudioScene;
+
+/////////////////////////////////////////////////
+/// \brief Handle to a sound source placed in an audio scene
+///
+/// Emitters are cheap to copy. Once removed from its scene,
+/// the emitter becomes invalid and the scene ignores it.
+///
+/// \see AudioScene
+/////////////////////////////////////////////////
+class AudioEmitter
+{
+    friend class AudioScene;
+
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Default constructor, creates an invalid emitter
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr AudioEmitter() : m_index(0), m_generation(0) {}
+
+    private:
+
+        /////////////////////////////////////////////////
+        /// \brief Constructor of an emitter added to a scene
+        ///
+        /// \param index      Index of the emitter in the scene
+        /// \param generation Generation of the emitter, distinguishes the emitters at the same index
+        /////////////////////////////////////////////////
+        constexpr AudioEmitter(uint32_t index, uint32_t generation) : m_index(index), m_generation(generation) {}
+
+        uint32_t m_index;      ///< Index of the emitter in the scene
+        uint32_t m_generation; ///< Generation of the emitter, 0 for an invalid emitter
+};
+
+}
+
+#endif // IKSDL_AUDIO_EMITTER_HPP
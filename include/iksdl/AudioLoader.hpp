@@ -0,0 +1,191 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_AUDIO_LOADER_HPP
+#define IKSDL_AUDIO_LOADER_HPP
+
+#include "iksdl/Job.hpp"
+#include "iksdl/Music.hpp"
+#include "iksdl/Sound.hpp"
+#include "iksdl/SoundPolicy.hpp"
+#include "iksdl/iksdl_export.hpp"
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace iksdl
+{
+
+/////////////////////////////////////////////////
+/// \brief Loads sounds and musics on background threads
+///
+/// Decoding a sound can take a long time, loading it on
+/// the main thread would freeze the game. The loads run
+/// on the \a JobSystem.
+///
+/// The loaded sounds and musics are either returned through
+/// a future, or given to a callback. The callbacks are called
+/// on the thread calling \a dispatchCompletions, which is
+/// usually the main thread once per frame.
+///
+/// If the audio device is not opened, the first loaded sound
+/// opens it from a loading thread. Call \a AudioDevice::open
+/// beforehand to choose the thread and the options.
+///
+/// \see Sound, Music, JobSystem
+/////////////////////////////////////////////////
+class AudioLoader
+{
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Default constructor
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT AudioLoader();
+
+        AudioLoader(const AudioLoader&) = delete;
+
+        /////////////////////////////////////////////////
+        /// \brief Destructor
+        ///
+        /// Waits for the loads in progress. The loads that did not
+        /// start yet are abandoned, their futures report a broken promise.
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT ~AudioLoader();
+
+        AudioLoader& operator=(const AudioLoader&) = delete;
+
+        /////////////////////////////////////////////////
+        /// \brief Load a sound in the background
+        ///
+        /// If the sound could not be loaded, the future
+        /// throws \a InvalidParameterException.
+        ///
+        /// \param filePath Path to audio file
+        /// \param policy   Limits applied when playing the sound
+        ///
+        /// \return Future giving the loaded sound
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT std::future<Sound> loadSound(const std::string& filePath, const SoundPolicy& policy = SoundPolicy());
+
+        /////////////////////////////////////////////////
+        /// \brief Load a sound in the background, then give it to a callback
+        ///
+        /// The callbacks are called by \a dispatchCompletions. If the sound
+        /// could not be loaded and there is no error callback,
+        /// \a dispatchCompletions throws \a InvalidParameterException.
+        ///
+        /// \param filePath Path to audio file
+        /// \param onLoaded Callback receiving the loaded sound
+        /// \param onError  Callback receiving the error if the sound could not be loaded
+        /// \param policy   Limits applied when playing the sound
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void loadSound(const std::string& filePath,
+                                    std::function<void(Sound&&)> onLoaded,
+                                    std::function<void(const std::exception&)> onError = {},
+                                    const SoundPolicy& policy = SoundPolicy());
+
+        /////////////////////////////////////////////////
+        /// \brief Load a music in the background
+        ///
+        /// If the music could not be loaded, the future
+        /// throws \a InvalidParameterException.
+        ///
+        /// \param filePath Path to audio file
+        ///
+        /// \return Future giving the loaded music
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT std::future<Music> loadMusic(const std::string& filePath);
+
+        /////////////////////////////////////////////////
+        /// \brief Load a music in the background, then give it to a callback
+        ///
+        /// The callbacks are called by \a dispatchCompletions. If the music
+        /// could not be loaded and there is no error callback,
+        /// \a dispatchCompletions throws \a InvalidParameterException.
+        ///
+        /// \param filePath Path to audio file
+        /// \param onLoaded Callback receiving the loaded music
+        /// \param onError  Callback receiving the error if the music could not be loaded
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void loadMusic(const std::string& filePath,
+                                    std::function<void(Music&&)> onLoaded,
+                                    std::function<void(const std::exception&)> onError = {});
+
+        /////////////////////////////////////////////////
+        /// \brief Call the callbacks of the finished loads
+        ///
+        /// \return Number of called callbacks
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT size_t dispatchCompletions();
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of loads that are not finished yet
+        ///
+        /// \return Number of loads waiting or in progress
+        /////////////////////////////////////////////////
+        inline size_t getPendingCount() const { return m_pending.load(std::memory_order_acquire); }
+
+    private:
+
+        /////////////////////////////////////////////////
+        /// \brief Schedule a load on the job system
+        ///
+        /// \param task Load to run on a worker thread
+        /////////////////////////////////////////////////
+        void submit(std::function<void()>&& task);
+
+        /////////////////////////////////////////////////
+        /// \brief Store a callback to be called by \a dispatchCompletions
+        ///
+        /// \param completion Callback of a finished load
+        /////////////////////////////////////////////////
+        void complete(std::function<void()>&& completion);
+
+        /////////////////////////////////////////////////
+        /// \brief Create a load that gives its result to callbacks
+        ///
+        /// \param onLoaded Callback receiving the loaded resource
+        /// \param onError  Callback receiving the error
+        /// \param load     Loads the resource
+        ///
+        /// \return Load to run on a worker thread
+        /////////////////////////////////////////////////
+        template<typename T, typename Load>
+        std::function<void()> makeTask(std::function<void(T&&)>&& onLoaded,
+                                       std::function<void(const std::exception&)>&& onError,
+                                       Load&& load);
+
+        std::vector<Job> m_jobs;                          ///< Jobs of the loads not known to be finished
+        std::atomic<bool> m_stopping;                     ///< Is the loader being destroyed?
+        std::vector<std::function<void()>> m_completions; ///< Callbacks of the finished loads
+        std::mutex m_completionsMutex;                    ///< Protects the callbacks of the finished loads
+        std::atomic<size_t> m_pending;                    ///< Number of loads not finished yet
+};
+
+}
+
+#endif // IKSDL_AUDIO_LOADER_HPP
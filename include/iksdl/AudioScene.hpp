@@ -0,0 +1,220 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_AUDIO_SCENE_HPP
+#define IKSDL_AUDIO_SCENE_HPP
+
+#include "iksdl/AudioEmitter.hpp"
+#include "iksdl/AudioSceneOptions.hpp"
+#include "iksdl/Position.hpp"
+#include "iksdl/Sound.hpp"
+#include "iksdl/Voice.hpp"
+#include "iksdl/iksdl_export.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace iksdl
+{
+
+/////////////////////////////////////////////////
+/// \brief Plays sounds placed in a 2D world, around a listener
+///
+/// Each emitter plays a sound, panned and attenuated according
+/// to its position relative to the listener. The panning and the
+/// attenuation of all the emitters are computed at once by
+/// \a update, which should be called once per frame. Only the
+/// values that changed are sent to the mixer.
+///
+/// The emitters beyond the hearing range are not played. An
+/// infinitely repeated emitter starts again from the beginning
+/// when it comes back in range, the other emitters are finished.
+///
+/// \see AudioSceneOptions, AudioEmitter
+/////////////////////////////////////////////////
+class AudioScene
+{
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Constructor
+        ///
+        /// This constructor will throw \a InvalidParameterException if
+        /// the distances of the options are not positive, or if the
+        /// full volume distance is not lower than the hearing range.
+        ///
+        /// \param options Options of the scene
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT explicit AudioScene(const AudioSceneOptions& options = AudioSceneOptions());
+
+        AudioScene(const AudioScene&) = delete;
+
+        /////////////////////////////////////////////////
+        /// \brief Destructor, stops all the emitters
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT ~AudioScene();
+
+        AudioScene& operator=(const AudioScene&) = delete;
+
+        /////////////////////////////////////////////////
+        /// \brief Add an emitter to the scene
+        ///
+        /// The emitter starts playing at the next \a update, if
+        /// it is in range. The sound must stay loaded while the
+        /// emitter is in the scene.
+        ///
+        /// \param sound    Sound played by the emitter
+        /// \param position Position of the emitter
+        /// \param loops    Number of times to play the sound, -1 to repeat it infinitely
+        ///
+        /// \return Handle to the emitter
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT AudioEmitter addEmitter(Sound& sound, const Positionf& position, int loops = -1);
+
+        /////////////////////////////////////////////////
+        /// \brief Remove an emitter from the scene and stop its sound
+        ///
+        /// \param emitter Emitter to remove
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void removeEmitter(const AudioEmitter& emitter);
+
+        /////////////////////////////////////////////////
+        /// \brief Is an emitter still in the scene?
+        ///
+        /// \param emitter Emitter to check
+        ///
+        /// \return True if the emitter was not removed
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT bool contains(const AudioEmitter& emitter) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Move an emitter
+        ///
+        /// \param emitter  Emitter to move
+        /// \param position New position of the emitter
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void setEmitterPosition(const AudioEmitter& emitter, const Positionf& position);
+
+        /////////////////////////////////////////////////
+        /// \brief Has an emitter finished playing its sound?
+        ///
+        /// An infinitely repeated emitter never finishes.
+        ///
+        /// \param emitter Emitter to check
+        ///
+        /// \return True if the emitter will not play anymore
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT bool isFinished(const AudioEmitter& emitter) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Get the voice currently playing the sound of an emitter
+        ///
+        /// The panning of the voice is managed by the scene,
+        /// its other settings can be changed.
+        ///
+        /// \param emitter Emitter playing the sound
+        ///
+        /// \return Voice of the emitter, invalid if it is not playing
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT Voice getVoice(const AudioEmitter& emitter) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Move the listener
+        ///
+        /// \param position New position of the listener
+        /////////////////////////////////////////////////
+        inline void setListenerPosition(const Positionf& position) { m_listener = position; }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the position of the listener
+        ///
+        /// \return Position of the listener
+        /////////////////////////////////////////////////
+        inline const Positionf& getListenerPosition() const { return m_listener; }
+
+        /////////////////////////////////////////////////
+        /// \brief Update the sounds of all the emitters
+        ///
+        /// Starts the emitters that came in range, stops the ones
+        /// that went out of range, and sends the new panning and
+        /// attenuation of the others to the mixer.
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void update();
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of emitters in the scene
+        ///
+        /// \return Number of emitters
+        /////////////////////////////////////////////////
+        inline size_t getEmittersCount() const { return m_slots.size() - m_freeSlots.size(); }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of emitters heard at the last update
+        ///
+        /// \return Number of emitters in range
+        /////////////////////////////////////////////////
+        inline size_t getAudibleCount() const { return m_audibleCount; }
+
+    private:
+
+        /////////////////////////////////////////////////
+        /// \brief State of an emitter that is not used by the batch computations
+        /////////////////////////////////////////////////
+        struct Slot
+        {
+            Sound* sound;        ///< Sound played by the emitter, nullptr for a free slot
+            Voice voice;         ///< Voice playing the sound
+            int loops;           ///< Number of times to play the sound
+            uint32_t generation; ///< Generation of the emitter using the slot
+            uint8_t sentLeft;    ///< Volume of the left side last sent to the mixer
+            uint8_t sentRight;   ///< Volume of the right side last sent to the mixer
+            bool started;        ///< Was the sound started at least once?
+            bool finished;       ///< Will the emitter not play anymore?
+        };
+
+        /////////////////////////////////////////////////
+        /// \brief Get the slot of an emitter
+        ///
+        /// \param emitter Emitter to find
+        ///
+        /// \return Slot of the emitter, or nullptr if it was removed
+        /////////////////////////////////////////////////
+        const Slot* find(const AudioEmitter& emitter) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Compute the volume of each side for all the emitters
+        /////////////////////////////////////////////////
+        void computeGains();
+
+        AudioSceneOptions m_options;       ///< Options of the scene
+        Positionf m_listener;              ///< Position of the listener
+        std::vector<float> m_x;            ///< Position of each emitter on X axis
+        std::vector<float> m_y;            ///< Position of each emitter on Y axis
+        std::vector<float> m_left;         ///< Volume of the left side of each emitter, between 0 and 1
+        std::vector<float> m_right;        ///< Volume of the right side of each emitter, between 0 and 1
+        std::vector<Slot> m_slots;         ///< Other states of the emitters
+        std::vector<uint32_t> m_freeSlots; ///< Indices of the slots of the removed emitters
+        size_t m_audibleCount;             ///< Number of emitters heard at the last update
+};
+
+}
+
+#endif // IKSDL_AUDIO_SCENE_HPP
@@ -0,0 +1,101 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_AUDIO_SCENE_OPTIONS_HPP
+#define IKSDL_AUDIO_SCENE_OPTIONS_HPP
+
+#include "iksdl/iksdl_export.hpp"
+
+namespace iksdl
+{
+
+class AudioScene;
+
+/////////////////////////////////////////////////
+/// \brief Allows to set how the distance to the listener changes the sounds of an audio scene
+///
+/// This class works with builder methods, it is possible
+/// to chain the calls to build the full set of options
+///
+/// \see AudioScene
+/////////////////////////////////////////////////
+class AudioSceneOptions
+{
+    friend class AudioScene;
+
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// By default, the sounds are heard up to 1000 units away,
+        /// at full volume up to 100 units away, and fully on one
+        /// side from 500 units away horizontally.
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr AudioSceneOptions() :
+            m_hearingRange(1000.f),
+            m_fullVolumeDistance(100.f),
+            m_panDistance(500.f)
+        {}
+
+        /////////////////////////////////////////////////
+        /// \brief Set the distance beyond which the sounds are not heard
+        ///
+        /// The emitters beyond this distance are not played.
+        ///
+        /// \param distance Maximum distance to the listener
+        ///
+        /// \return Options with the hearing range
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr AudioSceneOptions& hearingRange(float distance) { m_hearingRange = distance; return *this; }
+
+        /////////////////////////////////////////////////
+        /// \brief Set the distance below which the sounds are not attenuated
+        ///
+        /// Between this distance and the hearing range, the
+        /// volume decreases linearly.
+        ///
+        /// \param distance Maximum distance to the listener at full volume
+        ///
+        /// \return Options with the full volume distance
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr AudioSceneOptions& fullVolumeDistance(float distance) { m_fullVolumeDistance = distance; return *this; }
+
+        /////////////////////////////////////////////////
+        /// \brief Set the horizontal distance from which the sounds are only heard on one side
+        ///
+        /// \param distance Horizontal distance to the listener for a full panning
+        ///
+        /// \return Options with the panning distance
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr AudioSceneOptions& panDistance(float distance) { m_panDistance = distance; return *this; }
+
+    private:
+
+        float m_hearingRange;       ///< Maximum distance to the listener
+        float m_fullVolumeDistance; ///< Maximum distance to the listener at full volume
+        float m_panDistance;        ///< Horizontal distance to the listener for a full panning
+};
+
+}
+
+#endif // IKSDL_AUDIO_SCENE_OPTIONS_HPP
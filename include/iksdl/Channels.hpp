@@ -23,7 +23,10 @@
 #ifndef IKSDL_CHANNELS_HPP
 #define IKSDL_CHANNELS_HPP
 
-#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 
 namespace iksdl::priv
 {
@@ -31,6 +34,11 @@ namespace iksdl::priv
 /////////////////////////////////////////////////
 /// \brief Singleton that handles the use of audio channels
 ///
+/// The channels that are not reserved are kept in a lock-free
+/// list, so that reserving and freeing a channel are constant
+/// time operations. Channels can be freed from any thread,
+/// including the audio thread of SDL_mixer.
+///
 /// \warning This is IKSDL internal code that should not be
 /// used outside of the library
 /////////////////////////////////////////////////
@@ -53,13 +61,13 @@ class Channels
         /// of the same channel.
         ///
         /// If all the allocated audio channels are already reserved,
-        /// new audio channels are allocated. One of these
+        /// the number of allocated channels is doubled. One of these
         /// newly allocated channels is then reserved.
         ///
         /// Once the audio channel is not longer in use, it
         /// should be freed.
         ///
-        /// \return Reserved audio channel ID
+        /// \return Reserved audio channel ID, or -1 if the maximum number of channels is reached
         ///
         /// \see free
         /////////////////////////////////////////////////
@@ -76,7 +84,27 @@ class Channels
         ///
         /// \param channel Audio channel ID to free
         /////////////////////////////////////////////////
-        inline void free(int channel) { m_channels[channel] = false; };
+        void free(int channel);
+
+        /////////////////////////////////////////////////
+        /// \brief Allocate the channels again after the audio device was reopened
+        ///
+        /// Opening the audio device resets the number of
+        /// channels allocated by SDL_mixer.
+        /////////////////////////////////////////////////
+        void restore();
+
+        /////////////////////////////////////////////////
+        /// \brief Is an audio channel reserved?
+        ///
+        /// \param channel Audio channel ID
+        ///
+        /// \return True if the channel is reserved and has not been freed yet
+        /////////////////////////////////////////////////
+        inline bool isReserved(int channel) const
+        {
+            return channel >= 0 && channel < MAX_CHANNELS && m_reserved[channel].load(std::memory_order_acquire);
+        }
 
     private:
 
@@ -85,9 +113,29 @@ class Channels
         /////////////////////////////////////////////////
         Channels();
 
-        static constexpr unsigned int ALLOCATION_STEP = 2; ///< Number of channels to allocate when none is available
+        /////////////////////////////////////////////////
+        /// \brief Add a channel to the list of available channels
+        ///
+        /// \param channel Audio channel ID
+        /////////////////////////////////////////////////
+        void push(int32_t channel);
+
+        /////////////////////////////////////////////////
+        /// \brief Remove a channel from the list of available channels
+        ///
+        /// \return Audio channel ID, or -1 if no channel is available
+        /////////////////////////////////////////////////
+        int32_t pop();
+
+        static constexpr int MIN_CHANNELS = 8;    ///< Minimum number of allocated channels
+        static constexpr int MAX_CHANNELS = 4096; ///< Maximum number of allocated channels
+        static constexpr int32_t NO_CHANNEL = -1; ///< End of the list of available channels
 
-        std::vector<bool> m_channels; ///< Reservation state of the audio channels
+        std::unique_ptr<std::atomic<int32_t>[]> m_next;  ///< Next available channel, for each available channel
+        std::unique_ptr<std::atomic<bool>[]> m_reserved; ///< Reservation state of the audio channels
+        std::atomic<uint64_t> m_head;                    ///< First available channel in the low bits, modification counter in the high bits
+        std::atomic<int> m_count;                        ///< Number of allocated channels
+        std::mutex m_allocationMutex;                    ///< Prevents concurrent allocations of new channels
 };
 
 /////////////////////////////////////////////////
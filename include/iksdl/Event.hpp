@@ -23,19 +23,30 @@
 #ifndef IKSDL_EVENT_HPP
 #define IKSDL_EVENT_HPP
 
-#include "iksdl/AbstractEvent.hpp"
 #include "iksdl/EventHandler.hpp"
+#include "iksdl/QuitEvent.hpp"
+#include "iksdl/WindowEvent.hpp"
+#include "iksdl/KeyboardEvent.hpp"
+#include "iksdl/MouseMotionEvent.hpp"
+#include "iksdl/MouseButtonEvent.hpp"
+#include "iksdl/MouseWheelEvent.hpp"
+#include "iksdl/UserEvent.hpp"
 #include "iksdl/iksdl_export.hpp"
-#include <memory>
+#include <type_traits>
+#include <variant>
 
 namespace iksdl
 {
-class EventHandler;
 
 /////////////////////////////////////////////////
 /// \brief Represents an event that can be handled
 ///
 /// It is not the event itself, but a container of an event.
+///
+/// The event is stored inline, so building, returning and
+/// copying an event never allocates memory, except for the
+/// payload of a \a UserEvent, which may be allocated when
+/// the event is copied.
 /////////////////////////////////////////////////
 class Event
 {
@@ -46,26 +57,62 @@ class Event
         /////////////////////////////////////////////////
         enum class Type { Window, Keyboard, MouseMotion, MouseButton, MouseWheel };
 
+        /////////////////////////////////////////////////
+        /// \brief Constructor of an empty container
+        /////////////////////////////////////////////////
+        inline Event() : m_event() {}
+
         /////////////////////////////////////////////////
         /// \brief Constructor
         ///
         /// \param event Underlying event
         /////////////////////////////////////////////////
-        IKSDL_EXPORT explicit Event(std::unique_ptr<AbstractEvent> event);
+        template<typename E, typename = std::enable_if_t<std::is_base_of_v<AbstractEvent, std::decay_t<E>>>>
+        explicit Event(E&& event) : m_event(std::forward<E>(event)) {}
 
         /////////////////////////////////////////////////
         /// \brief Make the given handler execute the action related to the contained event
         ///
         /// \param handler Event handler that will be asked to consume the event
         /////////////////////////////////////////////////
-        inline void play(EventHandler& handler) const { if(m_event != nullptr) m_event->play(handler); }
+        IKSDL_EXPORT void play(EventHandler& handler) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Call the given visitor with the contained event
+        ///
+        /// The visitor is called with a constant reference to the
+        /// concrete event, so it must be callable with every
+        /// event type, for example a generic lambda. Nothing is
+        /// called if no event is present.
+        ///
+        /// \param visitor Function object receiving the event
+        /////////////////////////////////////////////////
+        template<typename Visitor>
+        void visit(Visitor&& visitor) const
+        {
+            std::visit([&visitor](const auto& event)
+                       {
+                           if constexpr(!std::is_same_v<std::decay_t<decltype(event)>, std::monostate>)
+                               visitor(event);
+                       }, m_event);
+        }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the contained event if it has the given type
+        ///
+        /// \tparam E Concrete event type
+        ///
+        /// \return Pointer to the event, or null if the contained event has another type
+        /////////////////////////////////////////////////
+        template<typename E>
+        inline const E* getIf() const { return std::get_if<E>(&m_event); }
 
         /////////////////////////////////////////////////
         /// \brief Does this container really contain an event?
         ///
         /// \return True if an event is present
         /////////////////////////////////////////////////
-        inline bool isPresent() const { return m_event != nullptr; }
+        inline bool isPresent() const { return !std::holds_alternative<std::monostate>(m_event); }
 
         /////////////////////////////////////////////////
         /// \brief Check whether an event is present
@@ -75,11 +122,14 @@ class Event
         ///
         /// \see isPresent
         /////////////////////////////////////////////////
-        inline explicit operator bool() const { return m_event != nullptr; }
+        inline explicit operator bool() const { return isPresent(); }
 
     private:
 
-        std::unique_ptr<AbstractEvent> m_event; ///< Contained event
+        using Storage = std::variant<std::monostate, QuitEvent, WindowEvent, KeyboardEvent,
+                                     MouseMotionEvent, MouseButtonEvent, MouseWheelEvent, UserEvent>;
+
+        Storage m_event; ///< Contained event
 };
 
 }
@@ -0,0 +1,99 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_EVENT_BUILDER_HPP
+#define IKSDL_EVENT_BUILDER_HPP
+
+#include "iksdl/Event.hpp"
+#include "iksdl/EventSupport.hpp"
+#include "iksdl/SdlException.hpp"
+#include "iksdl/UserEventQueue.hpp"
+#include <SDL.h>
+
+namespace iksdl::priv
+{
+
+/////////////////////////////////////////////////
+/// \brief Build a \a iksdl::event from a SDL event
+///
+/// \tparam E Event types to handle, other types are ignored
+///
+/// \param sdlEvent SDL event to transform
+///
+/// \return Transformed event
+///
+/// \warning This is IKSDL internal code that should not be
+/// used outside of the library
+/////////////////////////////////////////////////
+template<EventSupport E>
+Event buildEvent(const SDL_Event& sdlEvent)
+{
+    try
+    {
+        // The event router attaches the posted payload to each user event
+        if(sdlEvent.type == UserEventQueue::getInstance()->getWakeUpType() && sdlEvent.user.data1 != nullptr)
+            return Event(UserEvent(UserEventQueue::release(static_cast<UserEventQueue::Node*>(sdlEvent.user.data1))));
+
+        if constexpr(E.mouseMotionEventsEnabled)
+        {
+            if(sdlEvent.type == SDL_MOUSEMOTION)
+                return Event(MouseMotionEvent(sdlEvent.motion));
+        }
+
+        if constexpr(E.mouseButtonEventsEnabled)
+        {
+            if(sdlEvent.type == SDL_MOUSEBUTTONDOWN || sdlEvent.type == SDL_MOUSEBUTTONUP)
+                return Event(MouseButtonEvent(sdlEvent.button));
+        }
+
+        if constexpr(E.keyboardEventsEnabled)
+        {
+            if(sdlEvent.type == SDL_KEYDOWN || sdlEvent.type == SDL_KEYUP)
+                return Event(KeyboardEvent(sdlEvent.key));
+        }
+
+        if constexpr(E.mouseWheelEventsEnabled)
+        {
+            if(sdlEvent.type == SDL_MOUSEWHEEL)
+                return Event(MouseWheelEvent(sdlEvent.wheel));
+        }
+
+        if constexpr(E.windowEventsEnabled)
+        {
+            if(sdlEvent.type == SDL_WINDOWEVENT)
+                return Event(WindowEvent(sdlEvent.window));
+        }
+
+        if(sdlEvent.type == SDL_QUIT)
+            return Event(QuitEvent());
+
+        return Event();
+    }
+    catch(const SdlException&)
+    {
+        return Event();
+    }
+}
+
+}
+
+#endif // IKSDL_EVENT_BUILDER_HPP
@@ -0,0 +1,97 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_EVENT_COALESCING_HPP
+#define IKSDL_EVENT_COALESCING_HPP
+
+#include "iksdl/iksdl_export.hpp"
+
+namespace iksdl
+{
+
+namespace priv
+{
+class EventRouter;
+}
+
+/////////////////////////////////////////////////
+/// \brief Allows to choose which events of a window are merged before being polled
+///
+/// When several events of an enabled type follow each other
+/// in the queue of a window, they are merged into a single
+/// event, so that high-rate devices do not flood the handlers.
+/// Events of other types are never reordered.
+///
+/// This class works with builder methods, it is possible
+/// to chain the calls to build the full set of options
+///
+/// \see Window::setEventCoalescing
+/////////////////////////////////////////////////
+class EventCoalescing
+{
+    friend class priv::EventRouter;
+
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Default constructor with no coalescing activated
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr EventCoalescing() : m_mouseMotion(false), m_mouseWheel(false), m_windowSize(false) {}
+
+        /////////////////////////////////////////////////
+        /// \brief Merge consecutive mouse motion events
+        ///
+        /// The merged event has the last mouse position and the
+        /// sum of the relative movements.
+        ///
+        /// \return Options with mouse motion coalescing activated
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr EventCoalescing& mouseMotion() { m_mouseMotion = true; return *this; }
+
+        /////////////////////////////////////////////////
+        /// \brief Merge consecutive mouse wheel events
+        ///
+        /// The merged event has the sum of the scroll amounts.
+        ///
+        /// \return Options with mouse wheel coalescing activated
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr EventCoalescing& mouseWheel() { m_mouseWheel = true; return *this; }
+
+        /////////////////////////////////////////////////
+        /// \brief Merge consecutive window resize events
+        ///
+        /// Only the last size is kept.
+        ///
+        /// \return Options with window size coalescing activated
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr EventCoalescing& windowSize() { m_windowSize = true; return *this; }
+
+    private:
+
+        bool m_mouseMotion; ///< Are mouse motion events merged?
+        bool m_mouseWheel;  ///< Are mouse wheel events merged?
+        bool m_windowSize;  ///< Are window resize events merged?
+};
+
+}
+
+#endif // IKSDL_EVENT_COALESCING_HPP
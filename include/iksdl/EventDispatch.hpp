@@ -0,0 +1,133 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_EVENT_DISPATCH_HPP
+#define IKSDL_EVENT_DISPATCH_HPP
+
+#include "iksdl/Event.hpp"
+#include "iksdl/EventSupport.hpp"
+#include <concepts>
+#include <type_traits>
+
+namespace iksdl
+{
+
+/////////////////////////////////////////////////
+/// \brief Is the handler able to handle quit events?
+/////////////////////////////////////////////////
+template<typename Handler>
+concept QuitEventHandler = requires(Handler& handler, const QuitEvent& event) { handler.handleQuitEvent(event); };
+
+/////////////////////////////////////////////////
+/// \brief Is the handler able to handle window events?
+/////////////////////////////////////////////////
+template<typename Handler>
+concept WindowEventHandler = requires(Handler& handler, const WindowEvent& event) { handler.handleWindowEvent(event); };
+
+/////////////////////////////////////////////////
+/// \brief Is the handler able to handle keyboard events?
+/////////////////////////////////////////////////
+template<typename Handler>
+concept KeyboardEventHandler = requires(Handler& handler, const KeyboardEvent& event) { handler.handleKeyboardEvent(event); };
+
+/////////////////////////////////////////////////
+/// \brief Is the handler able to handle mouse motion events?
+/////////////////////////////////////////////////
+template<typename Handler>
+concept MouseMotionEventHandler = requires(Handler& handler, const MouseMotionEvent& event) { handler.handleMouseMotionEvent(event); };
+
+/////////////////////////////////////////////////
+/// \brief Is the handler able to handle mouse button events?
+/////////////////////////////////////////////////
+template<typename Handler>
+concept MouseButtonEventHandler = requires(Handler& handler, const MouseButtonEvent& event) { handler.handleMouseButtonEvent(event); };
+
+/////////////////////////////////////////////////
+/// \brief Is the handler able to handle mouse wheel events?
+/////////////////////////////////////////////////
+template<typename Handler>
+concept MouseWheelEventHandler = requires(Handler& handler, const MouseWheelEvent& event) { handler.handleMouseWheelEvent(event); };
+
+/////////////////////////////////////////////////
+/// \brief Is the handler able to handle user events?
+/////////////////////////////////////////////////
+template<typename Handler>
+concept UserEventHandler = requires(Handler& handler, const UserEvent& event) { handler.handleUserEvent(event); };
+
+/////////////////////////////////////////////////
+/// \brief Is the handler able to handle at least one type of event?
+///
+/// Such a handler only needs to provide the \c handleXxxEvent
+/// methods for the events it cares about, it does not have
+/// to extend \a EventHandler.
+/////////////////////////////////////////////////
+template<typename Handler>
+concept StaticEventHandler = QuitEventHandler<Handler> || WindowEventHandler<Handler> || KeyboardEventHandler<Handler> ||
+                             MouseMotionEventHandler<Handler> || MouseButtonEventHandler<Handler> ||
+                             MouseWheelEventHandler<Handler> || UserEventHandler<Handler>;
+
+/////////////////////////////////////////////////
+/// \brief Set of events handled by a handler type
+///
+/// Events that the handler cannot handle are not built at all.
+/////////////////////////////////////////////////
+template<StaticEventHandler Handler>
+constexpr EventSupport HANDLED_EVENTS = EventSupport(WindowEventHandler<Handler>, KeyboardEventHandler<Handler>,
+                                                     MouseMotionEventHandler<Handler>, MouseButtonEventHandler<Handler>,
+                                                     MouseWheelEventHandler<Handler>);
+
+/////////////////////////////////////////////////
+/// \brief Give an event to the matching method of a handler
+///
+/// The method is called directly, so it can be inlined. Nothing
+/// happens if the handler has no method for this type of event.
+///
+/// \param handler Event handler that will be asked to consume the event
+/// \param event   Event to handle
+/////////////////////////////////////////////////
+template<StaticEventHandler Handler>
+void dispatchEvent(Handler& handler, const Event& event)
+{
+    event.visit([&handler](const auto& concreteEvent)
+                {
+                    using E = std::decay_t<decltype(concreteEvent)>;
+
+                    if constexpr(std::same_as<E, QuitEvent> && QuitEventHandler<Handler>)
+                        handler.handleQuitEvent(concreteEvent);
+                    else if constexpr(std::same_as<E, WindowEvent> && WindowEventHandler<Handler>)
+                        handler.handleWindowEvent(concreteEvent);
+                    else if constexpr(std::same_as<E, KeyboardEvent> && KeyboardEventHandler<Handler>)
+                        handler.handleKeyboardEvent(concreteEvent);
+                    else if constexpr(std::same_as<E, MouseMotionEvent> && MouseMotionEventHandler<Handler>)
+                        handler.handleMouseMotionEvent(concreteEvent);
+                    else if constexpr(std::same_as<E, MouseButtonEvent> && MouseButtonEventHandler<Handler>)
+                        handler.handleMouseButtonEvent(concreteEvent);
+                    else if constexpr(std::same_as<E, MouseWheelEvent> && MouseWheelEventHandler<Handler>)
+                        handler.handleMouseWheelEvent(concreteEvent);
+                    else if constexpr(std::same_as<E, UserEvent> && UserEventHandler<Handler>)
+                        handler.handleUserEvent(concreteEvent);
+                });
+}
+
+}
+
+#endif // IKSDL_EVENT_DISPATCH_HPP
@@ -32,6 +32,7 @@ class KeyboardEvent;
 class MouseMotionEvent;
 class MouseButtonEvent;
 class MouseWheelEvent;
+class UserEvent;
 
 /////////////////////////////////////////////////
 /// \brief Abstract handler for events
@@ -86,6 +87,15 @@ class EventHandler
         /// \param event Event to handle
         /////////////////////////////////////////////////
         virtual void handleMouseWheelEvent(const MouseWheelEvent& event) = 0;
+
+        /////////////////////////////////////////////////
+        /// \brief Handle a user event
+        ///
+        /// User events are ignored unless this method is overridden.
+        ///
+        /// \param event Event to handle
+        /////////////////////////////////////////////////
+        inline virtual void handleUserEvent([[maybe_unused]] const UserEvent& event) {}
 };
 
 }
@@ -0,0 +1,119 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_EVENT_RECORDER_HPP
+#define IKSDL_EVENT_RECORDER_HPP
+
+#include "iksdl/iksdl_export.hpp"
+#include <SDL.h>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+namespace iksdl
+{
+
+namespace priv
+{
+class EventRouter;
+}
+
+/////////////////////////////////////////////////
+/// \brief Records the events consumed by the windows into a binary log
+///
+/// While a recorder exists, every event returned by
+/// \a Window::pollEvent, \a Window::waitEvent and
+/// \a Window::dispatchEvents is written to the log, along with
+/// the number of the frame it was consumed in. The log can then
+/// be played again with \a EventReplay.
+///
+/// Only one recorder can be active at a time.
+///
+/// \see EventReplay
+/////////////////////////////////////////////////
+class EventRecorder
+{
+    friend class priv::EventRouter;
+
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Constructor, starting the recording
+        ///
+        /// This constructor will throw \a InvalidParameterException
+        /// if the file cannot be opened, or if another recorder
+        /// is already active.
+        ///
+        /// \param filePath Path of the log file to write
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT explicit EventRecorder(const std::string& filePath);
+
+        EventRecorder(const EventRecorder&) = delete;
+
+        /////////////////////////////////////////////////
+        /// \brief Destructor, stopping the recording
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT ~EventRecorder();
+
+        EventRecorder& operator=(const EventRecorder&) = delete;
+
+        /////////////////////////////////////////////////
+        /// \brief Start a new frame
+        ///
+        /// This should be called once per frame, so that the
+        /// events can be replayed in the same frames.
+        /////////////////////////////////////////////////
+        inline void nextFrame() { m_frame++; }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of the current frame
+        ///
+        /// \return Frame number, starting from 0
+        /////////////////////////////////////////////////
+        inline uint32_t getFrame() const { return m_frame; }
+
+    private:
+
+        /////////////////////////////////////////////////
+        /// \brief Check that no other recorder is active, before the log file is opened
+        ///
+        /// \param filePath Path of the log file
+        ///
+        /// \return Path of the log file
+        /////////////////////////////////////////////////
+        static const std::string& checkInactive(const std::string& filePath);
+
+        /////////////////////////////////////////////////
+        /// \brief Write an event to the log
+        ///
+        /// \param event Consumed SDL event
+        /////////////////////////////////////////////////
+        void record(const SDL_Event& event);
+
+        std::ofstream m_file;     ///< Log file
+        uint32_t m_frame;         ///< Current frame
+        uint32_t m_recordedFrame; ///< Frame of the last recorded event
+};
+
+}
+
+#endif // IKSDL_EVENT_RECORDER_HPP
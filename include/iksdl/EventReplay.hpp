@@ -0,0 +1,137 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_EVENT_REPLAY_HPP
+#define IKSDL_EVENT_REPLAY_HPP
+
+#include "iksdl/Event.hpp"
+#include "iksdl/EventBuilder.hpp"
+#include "iksdl/EventDispatch.hpp"
+#include "iksdl/EventSupport.hpp"
+#include "iksdl/Window.hpp"
+#include "iksdl/iksdl_export.hpp"
+#include <SDL.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace iksdl
+{
+
+/////////////////////////////////////////////////
+/// \brief Plays again the events of a log written by \a EventRecorder
+///
+/// The events are given back in the frames they were recorded
+/// in, through the same conversion as the window events. No
+/// window is needed, so a recorded session can be replayed
+/// headlessly to compare the performance of several builds.
+///
+/// \see EventRecorder
+/////////////////////////////////////////////////
+class EventReplay
+{
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Constructor loading a log
+        ///
+        /// This constructor will throw \a InvalidParameterException
+        /// if the file cannot be read or is not a valid log.
+        ///
+        /// \param filePath Path of the log file to read
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT explicit EventReplay(const std::string& filePath);
+
+        /////////////////////////////////////////////////
+        /// \brief Start a new frame
+        ///
+        /// The events recorded in this frame become available.
+        /////////////////////////////////////////////////
+        inline void nextFrame() { m_frame++; }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of the current frame
+        ///
+        /// \return Frame number, starting from 0
+        /////////////////////////////////////////////////
+        inline uint32_t getFrame() const { return m_frame; }
+
+        /////////////////////////////////////////////////
+        /// \brief Have all the events been played?
+        ///
+        /// \return True if no event is left
+        /////////////////////////////////////////////////
+        inline bool isFinished() const { return m_next >= m_records.size(); }
+
+        /////////////////////////////////////////////////
+        /// \brief Fetch the next event recorded in the current frame
+        ///
+        /// \tparam E Type of events to fetch
+        ///
+        /// \return Event ready to be handled, or an empty event if the current frame has no more event
+        /////////////////////////////////////////////////
+        template<EventSupport E = Window::ALL_EVENTS_SUPPORT>
+        Event pollEvent()
+        {
+            while(m_next < m_records.size() && m_records[m_next].frame <= m_frame)
+            {
+                Event event = priv::buildEvent<E>(m_records[m_next++].event);
+                if(event)
+                    return event;
+            }
+
+            return Event();
+        }
+
+        /////////////////////////////////////////////////
+        /// \brief Give all the events recorded in the current frame to a handler
+        ///
+        /// \param handler Event handler that will be asked to consume the events
+        ///
+        /// \see Window::dispatchEvents
+        /////////////////////////////////////////////////
+        template<StaticEventHandler Handler>
+        void dispatchEvents(Handler& handler)
+        {
+            while(const Event event = pollEvent<HANDLED_EVENTS<Handler>>())
+                dispatchEvent(handler, event);
+        }
+
+    private:
+
+        /////////////////////////////////////////////////
+        /// \brief Event of the log
+        /////////////////////////////////////////////////
+        struct Record
+        {
+            uint32_t frame;  ///< Frame in which the event was consumed
+            SDL_Event event; ///< Recorded event
+        };
+
+        std::vector<Record> m_records; ///< All the events of the log
+        size_t m_next;                 ///< Index of the next event to play
+        uint32_t m_frame;              ///< Current frame
+};
+
+}
+
+#endif // IKSDL_EVENT_REPLAY_HPP
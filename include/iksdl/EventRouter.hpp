@@ -0,0 +1,238 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_EVENT_ROUTER_HPP
+#define IKSDL_EVENT_ROUTER_HPP
+
+#include "iksdl/EventCoalescing.hpp"
+#include "iksdl/iksdl_export.hpp"
+#include <SDL.h>
+#include <cstdint>
+#include <vector>
+
+namespace iksdl
+{
+class EventRecorder;
+}
+
+namespace iksdl::priv
+{
+
+class UserEventQueue;
+
+/////////////////////////////////////////////////
+/// \brief Singleton that dispatches the SDL events to the windows they belong to
+///
+/// The SDL event queue is drained in bulk, and each event is
+/// stored in the queue of the window it targets. The events
+/// about the whole application, such as the quit event, are
+/// stored in the queues of all the windows. The other events
+/// that do not target a specific window, such as the joystick
+/// events, go to the window with the keyboard focus, or to the
+/// first window if none of them has it.
+///
+/// The queues are not bounded: the events of a window that is
+/// never polled pile up in its queue until it is unregistered.
+///
+/// This class must only be used from the thread that
+/// created the windows.
+///
+/// \warning This is IKSDL internal code that should not be
+/// used outside of the library
+/////////////////////////////////////////////////
+class EventRouter
+{
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Get the singleton instance
+        ///
+        /// \return Singleton instance
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static EventRouter* getInstance();
+
+        /////////////////////////////////////////////////
+        /// \brief Start routing the events of a window
+        ///
+        /// \param windowId Identifier of the window
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void registerWindow(uint32_t windowId);
+
+        /////////////////////////////////////////////////
+        /// \brief Stop routing the events of a window and drop its pending events
+        ///
+        /// \param windowId Identifier of the window
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void unregisterWindow(uint32_t windowId);
+
+        /////////////////////////////////////////////////
+        /// \brief Choose which events of a window are merged when they follow each other
+        ///
+        /// Only the events received after this call are merged.
+        ///
+        /// \param windowId   Identifier of the window
+        /// \param coalescing Types of events to merge
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void setCoalescing(uint32_t windowId, const EventCoalescing& coalescing);
+
+        /////////////////////////////////////////////////
+        /// \brief Set the recorder receiving the events consumed by the windows
+        ///
+        /// \param recorder Active recorder, or null to stop recording
+        /////////////////////////////////////////////////
+        inline void setRecorder(EventRecorder* recorder) { m_recorder = recorder; }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the recorder receiving the events consumed by the windows
+        ///
+        /// \return Active recorder, or null if there is none
+        /////////////////////////////////////////////////
+        inline EventRecorder* getRecorder() const { return m_recorder; }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the next pending event of a window
+        ///
+        /// When the window has no pending event, the SDL event
+        /// queue is drained once before giving up.
+        ///
+        /// \param windowId Identifier of the window
+        /// \param event    Filled with the event, if there is one
+        ///
+        /// \return True if an event was available
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT bool poll(uint32_t windowId, SDL_Event& event);
+
+        /////////////////////////////////////////////////
+        /// \brief Wait for the next event of a window
+        ///
+        /// \param windowId Identifier of the window
+        /// \param event    Filled with the event
+        ///
+        /// \return False if an error occurred while waiting
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT bool wait(uint32_t windowId, SDL_Event& event);
+
+        /////////////////////////////////////////////////
+        /// \brief Move all the events from the SDL event queue to the window queues
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void pump();
+
+    private:
+
+        /////////////////////////////////////////////////
+        /// \brief Ring buffer of the pending events of a window
+        /////////////////////////////////////////////////
+        struct WindowQueue
+        {
+            uint32_t windowId;             ///< Identifier of the window
+            std::vector<SDL_Event> events; ///< Storage of the ring buffer, its size is a power of 2
+            size_t head;                   ///< Index of the oldest event
+            size_t count;                  ///< Number of pending events
+            EventCoalescing coalescing;    ///< Types of events to merge
+        };
+
+        /////////////////////////////////////////////////
+        /// \brief Default constructor
+        /////////////////////////////////////////////////
+        EventRouter();
+
+        /////////////////////////////////////////////////
+        /// \brief Move the posted user events to the queue of the first window
+        ///
+        /// The events are left in the user event queue while there is no window.
+        ///
+        /// \param userEvents Queue of the posted user events
+        /////////////////////////////////////////////////
+        void routeUserEvents(UserEventQueue& userEvents);
+
+        /////////////////////////////////////////////////
+        /// \brief Find the queue of a window
+        ///
+        /// \param windowId Identifier of the window
+        ///
+        /// \return Queue of the window, or null if the window is not registered
+        /////////////////////////////////////////////////
+        WindowQueue* findQueue(uint32_t windowId);
+
+        /////////////////////////////////////////////////
+        /// \brief Find the queue of the window with the keyboard focus
+        ///
+        /// \return Queue of the focused window, of the first window if none is focused, or null if there is no window
+        /////////////////////////////////////////////////
+        WindowQueue* findFocusedQueue();
+
+        /////////////////////////////////////////////////
+        /// \brief Store an event at the end of a queue, growing it if it is full
+        ///
+        /// \param queue Queue to fill
+        /// \param event Event to store
+        /////////////////////////////////////////////////
+        static void push(WindowQueue& queue, const SDL_Event& event);
+
+        /////////////////////////////////////////////////
+        /// \brief Merge an event into the newest event of a queue, if they are compatible
+        ///
+        /// \param queue Queue to fill
+        /// \param event Event to merge
+        ///
+        /// \return True if the event was merged, false if it must be stored separately
+        /////////////////////////////////////////////////
+        static bool coalesce(WindowQueue& queue, const SDL_Event& event);
+
+        /////////////////////////////////////////////////
+        /// \brief Remove the oldest event of a queue
+        ///
+        /// \param queue Queue to read
+        /// \param event Filled with the event, if there is one
+        ///
+        /// \return True if the queue was not empty
+        /////////////////////////////////////////////////
+        static bool pop(WindowQueue& queue, SDL_Event& event);
+
+        /////////////////////////////////////////////////
+        /// \brief Does an event concern the whole application?
+        ///
+        /// \param event SDL event
+        ///
+        /// \return True if the event must be received by all the windows
+        /////////////////////////////////////////////////
+        static bool isGlobal(const SDL_Event& event);
+
+        /////////////////////////////////////////////////
+        /// \brief Get the window targeted by an event
+        ///
+        /// \param event SDL event
+        ///
+        /// \return Identifier of the window, or 0 if the event does not target a specific window
+        /////////////////////////////////////////////////
+        static uint32_t getTargetWindow(const SDL_Event& event);
+
+        static constexpr int PUMP_BATCH_SIZE = 64;       ///< Number of events taken from SDL at once
+        static constexpr size_t INITIAL_QUEUE_SIZE = 64; ///< Initial capacity of a window queue
+
+        std::vector<WindowQueue> m_queues; ///< Queues of the registered windows
+        EventRecorder* m_recorder;         ///< Recorder of the consumed events, if any
+};
+
+}
+
+#endif // IKSDL_EVENT_ROUTER_HPP
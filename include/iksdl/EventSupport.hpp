@@ -61,6 +61,23 @@ struct EventSupport
         mouseWheelEventsEnabled(std::find(supportedTypes.begin(), supportedTypes.end(), Event::Type::MouseWheel) != supportedTypes.end())
     {}
 
+    /////////////////////////////////////////////////
+    /// \brief Constructor enabling each event type separately
+    ///
+    /// \param window      Are window events enabled?
+    /// \param keyboard    Are keyboard events enabled?
+    /// \param mouseMotion Are mouse motion events enabled?
+    /// \param mouseButton Are mouse button events enabled?
+    /// \param mouseWheel  Are mouse wheel events enabled?
+    /////////////////////////////////////////////////
+    constexpr EventSupport(bool window, bool keyboard, bool mouseMotion, bool mouseButton, bool mouseWheel) :
+        windowEventsEnabled(window),
+        keyboardEventsEnabled(keyboard),
+        mouseMotionEventsEnabled(mouseMotion),
+        mouseButtonEventsEnabled(mouseButton),
+        mouseWheelEventsEnabled(mouseWheel)
+    {}
+
     const bool windowEventsEnabled;      ///< Are window events enabled?
     const bool keyboardEventsEnabled;    ///< Are keyboard events enabled?
     const bool mouseMotionEventsEnabled; ///< Are mouse motion events enabled?
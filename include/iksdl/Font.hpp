@@ -86,6 +86,11 @@ class Font
 
     private:
 
+        /////////////////////////////////////////////////
+        /// \brief Close the font and release SDL_ttf
+        /////////////////////////////////////////////////
+        void close();
+
         TTF_Font* m_font; ///< SDL font
 };
 
@@ -0,0 +1,191 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_GAME_LOOP_HPP
+#define IKSDL_GAME_LOOP_HPP
+
+#include "iksdl/GameLoopOptions.hpp"
+#include "iksdl/iksdl_export.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace iksdl
+{
+
+/////////////////////////////////////////////////
+/// \brief Drives a loop that updates a simulation with a fixed time step and renders it
+///
+/// Each frame of the loop handles the input, runs as many
+/// simulation steps as the elapsed time requires, then renders.
+/// The renderer receives an interpolation factor, between 0 and 1,
+/// telling how far the real time is between the last simulation
+/// step and the next one.
+///
+/// When a frame rate limit is set, the loop sleeps then spins
+/// until the end of each frame, so that frame times are stable
+/// without keeping a CPU core busy.
+///
+/// \see GameLoopOptions, Window::run
+/////////////////////////////////////////////////
+class GameLoop
+{
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Constructor
+        ///
+        /// \param options Loop options
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT explicit GameLoop(const GameLoopOptions& options = GameLoopOptions());
+
+        /////////////////////////////////////////////////
+        /// \brief Run the loop until it is stopped
+        ///
+        /// \param input  Called once per frame, with no parameter
+        /// \param update Called for each simulation step, with the time step as \a std::chrono::nanoseconds
+        /// \param render Called once per frame, with the interpolation factor as \c double
+        ///
+        /// \see stop
+        /////////////////////////////////////////////////
+        template<typename Input, typename Update, typename Render>
+        void run(Input&& input, Update&& update, Render&& render)
+        {
+            start();
+
+            while(m_running.load(std::memory_order_relaxed))
+            {
+                input();
+
+                const unsigned int steps = beginFrame();
+                for(unsigned int i = 0 ; i < steps && m_running.load(std::memory_order_relaxed) ; ++i)
+                    update(m_options.m_timeStep);
+
+                if(!m_running.load(std::memory_order_relaxed))
+                    break;
+
+                render(getInterpolation());
+                endFrame();
+            }
+        }
+
+        /////////////////////////////////////////////////
+        /// \brief Stop the loop at the end of the current step
+        ///
+        /// This method can be called from any thread.
+        /////////////////////////////////////////////////
+        inline void stop() { m_running.store(false, std::memory_order_relaxed); }
+
+        /////////////////////////////////////////////////
+        /// \brief Is the loop running?
+        ///
+        /// \return True if the loop is running
+        /////////////////////////////////////////////////
+        inline bool isRunning() const { return m_running.load(std::memory_order_relaxed); }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the interpolation factor between the last simulation step and the next one
+        ///
+        /// \return Factor between 0 and 1
+        /////////////////////////////////////////////////
+        inline double getInterpolation() const { return static_cast<double>(m_accumulator) / static_cast<double>(m_stepTicks); }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of frames rendered since the loop started
+        ///
+        /// \return Number of frames
+        /////////////////////////////////////////////////
+        inline uint64_t getFrameCount() const { return m_frameCount; }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of frames that missed their deadline since the loop started
+        ///
+        /// A frame is missed when it ends after the time given by
+        /// the frame rate limit, or when the simulation had to drop
+        /// late time because it could not catch up.
+        ///
+        /// \return Number of missed frames
+        /////////////////////////////////////////////////
+        inline uint64_t getMissedFrameCount() const { return m_missedFrameCount; }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the duration of the last frame, including the wait of the frame limiter
+        ///
+        /// \return Duration of the last frame
+        /////////////////////////////////////////////////
+        inline std::chrono::nanoseconds getLastFrameDuration() const { return m_lastFrameDuration; }
+
+    private:
+
+        /////////////////////////////////////////////////
+        /// \brief Reset the timing before running
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void start();
+
+        /////////////////////////////////////////////////
+        /// \brief Measure the elapsed time at the beginning of a frame
+        ///
+        /// \return Number of simulation steps to run in this frame
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT unsigned int beginFrame();
+
+        /////////////////////////////////////////////////
+        /// \brief Wait for the end of the frame according to the frame rate limit
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void endFrame();
+
+        /////////////////////////////////////////////////
+        /// \brief Convert a duration to performance counter ticks
+        ///
+        /// \param duration Duration to convert
+        ///
+        /// \return Number of ticks
+        /////////////////////////////////////////////////
+        uint64_t toTicks(std::chrono::nanoseconds duration) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Convert performance counter ticks to a duration
+        ///
+        /// \param ticks Number of ticks to convert
+        ///
+        /// \return Duration in nanoseconds
+        /////////////////////////////////////////////////
+        std::chrono::nanoseconds toNanoseconds(uint64_t ticks) const;
+
+        GameLoopOptions m_options;                ///< Loop options
+        std::atomic<bool> m_running;              ///< Is the loop running?
+        uint64_t m_frequency;                     ///< Performance counter ticks per second
+        uint64_t m_stepTicks;                     ///< Duration of a simulation step, in ticks
+        uint64_t m_frameTicks;                    ///< Minimum duration of a frame, in ticks, or 0 for no limit
+        uint64_t m_spinTicks;                     ///< Duration of spinning at the end of a frame, in ticks
+        uint64_t m_frameStart;                    ///< Time when the current frame started, in ticks
+        uint64_t m_deadline;                      ///< Time when the current frame should end, in ticks
+        uint64_t m_accumulator;                   ///< Elapsed time not yet simulated, in ticks
+        bool m_frameMissed;                       ///< Has the current frame already been counted as missed?
+        uint64_t m_frameCount;                    ///< Number of rendered frames
+        uint64_t m_missedFrameCount;              ///< Number of frames that missed their deadline
+        std::chrono::nanoseconds m_lastFrameDuration; ///< Duration of the last frame
+};
+
+}
+
+#endif // IKSDL_GAME_LOOP_HPP
@@ -0,0 +1,117 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_GAME_LOOP_OPTIONS_HPP
+#define IKSDL_GAME_LOOP_OPTIONS_HPP
+
+#include "iksdl/iksdl_export.hpp"
+#include <chrono>
+
+namespace iksdl
+{
+
+class GameLoop;
+
+/////////////////////////////////////////////////
+/// \brief Allows to set options for a game loop
+///
+/// This class works with builder methods, it is possible
+/// to chain the calls to build the full set of options
+///
+/// \see GameLoop
+/////////////////////////////////////////////////
+class GameLoopOptions
+{
+    friend class GameLoop;
+
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// By default, the simulation is updated 60 times per second,
+        /// and the frame rate is not limited.
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr GameLoopOptions() :
+            m_timeStep(std::chrono::nanoseconds(1'000'000'000) / 60),
+            m_frameRateLimit(0),
+            m_maxStepsPerFrame(5),
+            m_spinDuration(std::chrono::milliseconds(2))
+        {}
+
+        /////////////////////////////////////////////////
+        /// \brief Set the fixed duration of a simulation step
+        ///
+        /// \param step Simulated time between two updates
+        ///
+        /// \return Options with the given time step
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr GameLoopOptions& timeStep(std::chrono::nanoseconds step) { m_timeStep = step; return *this; }
+
+        /////////////////////////////////////////////////
+        /// \brief Limit the number of rendered frames per second
+        ///
+        /// This should not be used along with VSync, which already
+        /// limits the frame rate.
+        ///
+        /// \param framesPerSecond Maximum frame rate, or 0 for no limit
+        ///
+        /// \return Options with the frame rate limit
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr GameLoopOptions& frameRateLimit(unsigned int framesPerSecond) { m_frameRateLimit = framesPerSecond; return *this; }
+
+        /////////////////////////////////////////////////
+        /// \brief Set the maximum number of simulation steps done before rendering a frame
+        ///
+        /// When the simulation falls further behind, the late time
+        /// is dropped instead of trying to catch up indefinitely.
+        ///
+        /// \param steps Maximum number of updates per frame
+        ///
+        /// \return Options with the maximum number of steps per frame
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr GameLoopOptions& maxStepsPerFrame(unsigned int steps) { m_maxStepsPerFrame = steps; return *this; }
+
+        /////////////////////////////////////////////////
+        /// \brief Set how long the frame limiter spins before the end of a frame
+        ///
+        /// The frame limiter sleeps until this duration is left,
+        /// then spins to wake up on time. A longer duration makes
+        /// the frame times more stable but uses more CPU.
+        ///
+        /// \param duration Spinning duration
+        ///
+        /// \return Options with the spinning duration
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr GameLoopOptions& spinDuration(std::chrono::nanoseconds duration) { m_spinDuration = duration; return *this; }
+
+    private:
+
+        std::chrono::nanoseconds m_timeStep;     ///< Duration of a simulation step
+        unsigned int m_frameRateLimit;           ///< Maximum frames per second, 0 for no limit
+        unsigned int m_maxStepsPerFrame;         ///< Maximum simulation steps before a frame is rendered
+        std::chrono::nanoseconds m_spinDuration; ///< Duration of spinning at the end of a frame
+};
+
+}
+
+#endif // IKSDL_GAME_LOOP_OPTIONS_HPP
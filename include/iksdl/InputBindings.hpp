@@ -0,0 +1,147 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_INPUT_BINDINGS_HPP
+#define IKSDL_INPUT_BINDINGS_HPP
+
+#include "iksdl/InputChord.hpp"
+#include "iksdl/InputState.hpp"
+#include <type_traits>
+#include <vector>
+
+namespace iksdl
+{
+
+/////////////////////////////////////////////////
+/// \brief Table binding application actions to input chords
+///
+/// Each action may be bound to several chords, the action is
+/// active as soon as one of them is.
+///
+/// \tparam Action Enumeration of the actions, with values starting from 0
+///
+/// \see InputState, InputChord
+/////////////////////////////////////////////////
+template<typename Action>
+requires std::is_enum_v<Action>
+class InputBindings
+{
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Bind a chord to an action
+        ///
+        /// \param action Action to trigger
+        /// \param chord  Chord triggering the action
+        /////////////////////////////////////////////////
+        void bind(Action action, const InputChord& chord)
+        {
+            const size_t index = static_cast<size_t>(action);
+            if(index >= m_bindings.size())
+                m_bindings.resize(index + 1);
+
+            m_bindings[index].push_back(chord);
+        }
+
+        /////////////////////////////////////////////////
+        /// \brief Remove all the chords bound to an action
+        ///
+        /// \param action Action to unbind
+        /////////////////////////////////////////////////
+        void unbind(Action action)
+        {
+            const size_t index = static_cast<size_t>(action);
+            if(index < m_bindings.size())
+                m_bindings[index].clear();
+        }
+
+        /////////////////////////////////////////////////
+        /// \brief Is an action active?
+        ///
+        /// \param state  Input snapshot
+        /// \param action Action to check
+        ///
+        /// \return True if one of the chords of the action is pressed
+        /////////////////////////////////////////////////
+        bool isDown(const InputState& state, Action action) const
+        {
+            return anyChord(action, [&state](const InputChord& chord) { return state.isDown(chord); });
+        }
+
+        /////////////////////////////////////////////////
+        /// \brief Has an action just been triggered?
+        ///
+        /// \param state  Input snapshot
+        /// \param action Action to check
+        ///
+        /// \return True if one of the chords of the action has just been completed
+        /////////////////////////////////////////////////
+        bool wentDown(const InputState& state, Action action) const
+        {
+            return anyChord(action, [&state](const InputChord& chord) { return state.wentDown(chord); });
+        }
+
+        /////////////////////////////////////////////////
+        /// \brief Has an action just been released?
+        ///
+        /// \param state  Input snapshot
+        /// \param action Action to check
+        ///
+        /// \return True if one of the chords of the action has just been broken
+        /////////////////////////////////////////////////
+        bool wentUp(const InputState& state, Action action) const
+        {
+            return anyChord(action, [&state](const InputChord& chord) { return state.wentUp(chord); });
+        }
+
+    private:
+
+        /////////////////////////////////////////////////
+        /// \brief Check whether a predicate is true for one of the chords of an action
+        ///
+        /// \param action    Action whose chords are checked
+        /// \param predicate Predicate to check
+        ///
+        /// \return True if the predicate is true for at least one chord
+        /////////////////////////////////////////////////
+        template<typename Predicate>
+        bool anyChord(Action action, Predicate&& predicate) const
+        {
+            const size_t index = static_cast<size_t>(action);
+            if(index >= m_bindings.size())
+                return false;
+
+            for(const InputChord& chord : m_bindings[index])
+            {
+                if(predicate(chord))
+                    return true;
+            }
+
+            return false;
+        }
+
+        std::vector<std::vector<InputChord>> m_bindings; ///< Chords bound to each action
+};
+
+}
+
+#endif // IKSDL_INPUT_BINDINGS_HPP
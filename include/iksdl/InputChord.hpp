@@ -0,0 +1,84 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_INPUT_CHORD_HPP
+#define IKSDL_INPUT_CHORD_HPP
+
+#include "iksdl/Keyboard.hpp"
+#include "iksdl/Mouse.hpp"
+#include <bitset>
+#include <initializer_list>
+
+namespace iksdl
+{
+
+class InputState;
+
+/////////////////////////////////////////////////
+/// \brief Combination of keys and mouse buttons that must be pressed together
+///
+/// \see InputState, InputBindings
+/////////////////////////////////////////////////
+class InputChord
+{
+    friend class InputState;
+
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Constructor
+        ///
+        /// \param keys    Keys of the chord
+        /// \param buttons Mouse buttons of the chord
+        /////////////////////////////////////////////////
+        InputChord(std::initializer_list<Keyboard::Key> keys, std::initializer_list<Mouse::Button> buttons = {})
+        {
+            for(const Keyboard::Key key : keys)
+                m_keys.set(static_cast<size_t>(key));
+
+            for(const Mouse::Button button : buttons)
+                m_buttons.set(static_cast<size_t>(button));
+        }
+
+        /////////////////////////////////////////////////
+        /// \brief Constructor of a chord made of a single key
+        ///
+        /// \param key Key of the chord
+        /////////////////////////////////////////////////
+        InputChord(Keyboard::Key key) { m_keys.set(static_cast<size_t>(key)); }
+
+        /////////////////////////////////////////////////
+        /// \brief Constructor of a chord made of a single mouse button
+        ///
+        /// \param button Mouse button of the chord
+        /////////////////////////////////////////////////
+        InputChord(Mouse::Button button) { m_buttons.set(static_cast<size_t>(button)); }
+
+    private:
+
+        std::bitset<Keyboard::KEY_COUNT> m_keys;    ///< Keys of the chord
+        std::bitset<Mouse::BUTTON_COUNT> m_buttons; ///< Mouse buttons of the chord
+};
+
+}
+
+#endif // IKSDL_INPUT_CHORD_HPP
@@ -0,0 +1,186 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_INPUT_STATE_HPP
+#define IKSDL_INPUT_STATE_HPP
+
+#include "iksdl/InputChord.hpp"
+#include "iksdl/Keyboard.hpp"
+#include "iksdl/Mouse.hpp"
+#include "iksdl/Position.hpp"
+#include "iksdl/iksdl_export.hpp"
+#include <bitset>
+
+namespace iksdl
+{
+
+/////////////////////////////////////////////////
+/// \brief Snapshot of the keyboard and mouse, taken once per frame
+///
+/// Unlike \a Keyboard::isKeyPressed and \a Mouse::isButtonPressed,
+/// which process the system events on each call, this class
+/// processes them once in \a update. All the queries then read
+/// the snapshot, and compare it with the previous one to detect
+/// presses and releases.
+///
+/// \see InputChord, InputBindings
+/////////////////////////////////////////////////
+class InputState
+{
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Default constructor, with nothing pressed
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT InputState();
+
+        /////////////////////////////////////////////////
+        /// \brief Take a new snapshot of the keyboard and mouse
+        ///
+        /// This should be called once per frame, before the queries.
+        /// The current snapshot becomes the previous one.
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void update();
+
+        /////////////////////////////////////////////////
+        /// \brief Is a key pressed?
+        ///
+        /// \param key Key to check
+        ///
+        /// \return True if the key is pressed in the current snapshot
+        /////////////////////////////////////////////////
+        inline bool isDown(Keyboard::Key key) const { return m_keys[static_cast<size_t>(key)]; }
+
+        /////////////////////////////////////////////////
+        /// \brief Has a key just been pressed?
+        ///
+        /// \param key Key to check
+        ///
+        /// \return True if the key is pressed now but was not in the previous snapshot
+        /////////////////////////////////////////////////
+        inline bool wentDown(Keyboard::Key key) const { return m_keys[static_cast<size_t>(key)] && !m_previousKeys[static_cast<size_t>(key)]; }
+
+        /////////////////////////////////////////////////
+        /// \brief Has a key just been released?
+        ///
+        /// \param key Key to check
+        ///
+        /// \return True if the key was pressed in the previous snapshot but is not now
+        /////////////////////////////////////////////////
+        inline bool wentUp(Keyboard::Key key) const { return !m_keys[static_cast<size_t>(key)] && m_previousKeys[static_cast<size_t>(key)]; }
+
+        /////////////////////////////////////////////////
+        /// \brief Is a mouse button pressed?
+        ///
+        /// \param button Mouse button to check
+        ///
+        /// \return True if the button is pressed in the current snapshot
+        /////////////////////////////////////////////////
+        inline bool isDown(Mouse::Button button) const { return m_buttons[static_cast<size_t>(button)]; }
+
+        /////////////////////////////////////////////////
+        /// \brief Has a mouse button just been pressed?
+        ///
+        /// \param button Mouse button to check
+        ///
+        /// \return True if the button is pressed now but was not in the previous snapshot
+        /////////////////////////////////////////////////
+        inline bool wentDown(Mouse::Button button) const { return m_buttons[static_cast<size_t>(button)] && !m_previousButtons[static_cast<size_t>(button)]; }
+
+        /////////////////////////////////////////////////
+        /// \brief Has a mouse button just been released?
+        ///
+        /// \param button Mouse button to check
+        ///
+        /// \return True if the button was pressed in the previous snapshot but is not now
+        /////////////////////////////////////////////////
+        inline bool wentUp(Mouse::Button button) const { return !m_buttons[static_cast<size_t>(button)] && m_previousButtons[static_cast<size_t>(button)]; }
+
+        /////////////////////////////////////////////////
+        /// \brief Are all the keys and buttons of a chord pressed?
+        ///
+        /// \param chord Chord to check
+        ///
+        /// \return True if the whole chord is pressed in the current snapshot
+        /////////////////////////////////////////////////
+        inline bool isDown(const InputChord& chord) const { return matches(chord, m_keys, m_buttons); }
+
+        /////////////////////////////////////////////////
+        /// \brief Has a chord just been completed?
+        ///
+        /// \param chord Chord to check
+        ///
+        /// \return True if the whole chord is pressed now but was not in the previous snapshot
+        /////////////////////////////////////////////////
+        inline bool wentDown(const InputChord& chord) const { return isDown(chord) && !matches(chord, m_previousKeys, m_previousButtons); }
+
+        /////////////////////////////////////////////////
+        /// \brief Has a chord just been broken?
+        ///
+        /// \param chord Chord to check
+        ///
+        /// \return True if the whole chord was pressed in the previous snapshot but is not now
+        /////////////////////////////////////////////////
+        inline bool wentUp(const InputChord& chord) const { return !isDown(chord) && matches(chord, m_previousKeys, m_previousButtons); }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the mouse position
+        ///
+        /// \return Mouse position in the current snapshot
+        /////////////////////////////////////////////////
+        inline const Positioni& getMousePosition() const { return m_mousePosition; }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the mouse movement since the previous snapshot
+        ///
+        /// \return Mouse movement
+        /////////////////////////////////////////////////
+        inline Positioni getMouseMovement() const { return m_mousePosition - m_previousMousePosition; }
+
+    private:
+
+        /////////////////////////////////////////////////
+        /// \brief Check whether a chord is pressed in a snapshot
+        ///
+        /// \param chord   Chord to check
+        /// \param keys    Pressed keys of the snapshot
+        /// \param buttons Pressed mouse buttons of the snapshot
+        ///
+        /// \return True if the whole chord is pressed
+        /////////////////////////////////////////////////
+        static inline bool matches(const InputChord& chord, const std::bitset<Keyboard::KEY_COUNT>& keys,
+                                   const std::bitset<Mouse::BUTTON_COUNT>& buttons)
+        {
+            return (keys & chord.m_keys) == chord.m_keys && (buttons & chord.m_buttons) == chord.m_buttons;
+        }
+
+        std::bitset<Keyboard::KEY_COUNT> m_keys;            ///< Keys pressed in the current snapshot
+        std::bitset<Keyboard::KEY_COUNT> m_previousKeys;    ///< Keys pressed in the previous snapshot
+        std::bitset<Mouse::BUTTON_COUNT> m_buttons;         ///< Mouse buttons pressed in the current snapshot
+        std::bitset<Mouse::BUTTON_COUNT> m_previousButtons; ///< Mouse buttons pressed in the previous snapshot
+        Positioni m_mousePosition;                          ///< Mouse position in the current snapshot
+        Positioni m_previousMousePosition;                  ///< Mouse position in the previous snapshot
+};
+
+}
+
+#endif // IKSDL_INPUT_STATE_HPP
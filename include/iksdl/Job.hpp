@@ -0,0 +1,93 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_JOB_HPP
+#define IKSDL_JOB_HPP
+
+#include "iksdl/iksdl_export.hpp"
+#include <memory>
+
+namespace iksdl
+{
+
+namespace priv
+{
+struct JobState;
+}
+
+/////////////////////////////////////////////////
+/// \brief Handle to a job scheduled on the \a JobSystem
+///
+/// Jobs are cheap to copy. A job can be waited for, or be
+/// given as a dependency of other jobs.
+///
+/// \see JobSystem
+/////////////////////////////////////////////////
+class Job
+{
+    friend class JobSystem;
+
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Default constructor, creates an invalid job
+        ///
+        /// An invalid job is considered finished.
+        /////////////////////////////////////////////////
+        Job() = default;
+
+        /////////////////////////////////////////////////
+        /// \brief Has the job finished running?
+        ///
+        /// \return True if the job has run, or if it is invalid
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT bool isFinished() const;
+
+        /////////////////////////////////////////////////
+        /// \brief Is the job valid?
+        ///
+        /// \return True if the job was returned by the job system
+        /////////////////////////////////////////////////
+        inline bool isValid() const { return m_state != nullptr; }
+
+        /////////////////////////////////////////////////
+        /// \brief Is the job valid?
+        ///
+        /// \return True if the job was returned by the job system
+        /////////////////////////////////////////////////
+        inline explicit operator bool() const { return isValid(); }
+
+    private:
+
+        /////////////////////////////////////////////////
+        /// \brief Constructor from the state of a scheduled job
+        ///
+        /// \param state State of the job
+        /////////////////////////////////////////////////
+        explicit Job(std::shared_ptr<priv::JobState> state);
+
+        std::shared_ptr<priv::JobState> m_state; ///< State of the job, shared with the job system
+};
+
+}
+
+#endif // IKSDL_JOB_HPP
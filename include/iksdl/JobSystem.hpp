@@ -0,0 +1,163 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_JOB_SYSTEM_HPP
+#define IKSDL_JOB_SYSTEM_HPP
+
+#include "iksdl/Job.hpp"
+#include "iksdl/JobSystemOptions.hpp"
+#include "iksdl/iksdl_export.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace iksdl
+{
+
+/////////////////////////////////////////////////
+/// \brief Runs jobs on a pool of worker threads
+///
+/// Each worker has its own queue of jobs. The jobs scheduled
+/// by a job go to the queue of its worker, and a worker with an
+/// empty queue steals jobs from the other ones, so that all
+/// the cores stay busy without a shared queue to fight for.
+///
+/// The threads waiting for a job run the other jobs meanwhile,
+/// so that jobs can wait for other jobs without blocking a worker.
+///
+/// The library runs its own background work on this system, such
+/// as the loading of the assets. It is started with the default
+/// options when it is first used, unless \a start was called before.
+///
+/// \see Job, JobSystemOptions
+/////////////////////////////////////////////////
+class JobSystem
+{
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Start the worker threads
+        ///
+        /// If the system is already running, it is stopped first.
+        ///
+        /// \param options Options of the system
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static void start(const JobSystemOptions& options = JobSystemOptions());
+
+        /////////////////////////////////////////////////
+        /// \brief Run all the scheduled jobs, then stop the worker threads
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static void stop();
+
+        /////////////////////////////////////////////////
+        /// \brief Are the worker threads running?
+        ///
+        /// \return True if the system is started
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static bool isRunning();
+
+        /////////////////////////////////////////////////
+        /// \brief Run a function on a worker thread
+        ///
+        /// \param task Function to run
+        ///
+        /// \return Handle to the job
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static Job schedule(std::function<void()> task);
+
+        /////////////////////////////////////////////////
+        /// \brief Run a function on a worker thread once other jobs have finished
+        ///
+        /// \param task         Function to run
+        /// \param dependencies Jobs that must finish before this one starts
+        ///
+        /// \return Handle to the job
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static Job schedule(std::function<void()> task, const std::vector<Job>& dependencies);
+
+        /////////////////////////////////////////////////
+        /// \brief Wait for a job to finish, running other jobs meanwhile
+        ///
+        /// If the job threw an exception, it is thrown again by this method.
+        ///
+        /// \param job Job to wait for
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static void wait(const Job& job);
+
+        /////////////////////////////////////////////////
+        /// \brief Run a function over a range of indices, split between the threads
+        ///
+        /// The range is split in halves until the parts are not larger
+        /// than the grain, and the calling thread takes part in the work.
+        /// The method returns once the whole range is processed. If the
+        /// function threw an exception, the first one is thrown again.
+        ///
+        /// \param begin First index of the range
+        /// \param end   Index after the last one of the range
+        /// \param body  Function processing the indices from its first parameter to its second one, excluded
+        /// \param grain Maximum number of indices processed by one call of the function
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static void parallelFor(size_t begin, size_t end, const std::function<void(size_t, size_t)>& body,
+                                             size_t grain = 1);
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of worker threads
+        ///
+        /// \return Number of workers, 0 if the system is not running
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static unsigned int getWorkersCount();
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of jobs waiting in the queues
+        ///
+        /// \return Number of jobs ready to run but not started yet
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static size_t getQueueDepth();
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of jobs taken from the queue of another worker
+        ///
+        /// \return Number of steals since the start or the last reset
+        ///
+        /// \see resetStatistics
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static uint64_t getStealsCount();
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of jobs that have run
+        ///
+        /// \return Number of run jobs since the start or the last reset
+        ///
+        /// \see resetStatistics
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static uint64_t getExecutedCount();
+
+        /////////////////////////////////////////////////
+        /// \brief Reset the numbers of steals and run jobs
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static void resetStatistics();
+};
+
+}
+
+#endif // IKSDL_JOB_SYSTEM_HPP
@@ -0,0 +1,85 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_JOB_SYSTEM_OPTIONS_HPP
+#define IKSDL_JOB_SYSTEM_OPTIONS_HPP
+
+#include "iksdl/iksdl_export.hpp"
+
+namespace iksdl
+{
+
+class JobSystem;
+
+/////////////////////////////////////////////////
+/// \brief Allows to set options for the job system
+///
+/// This class works with builder methods, it is possible
+/// to chain the calls to build the full set of options
+///
+/// \see JobSystem
+/////////////////////////////////////////////////
+class JobSystemOptions
+{
+    friend class JobSystem;
+
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// There is one worker thread per CPU core except one, left to
+        /// the main thread, and the threads are not pinned to cores.
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr JobSystemOptions() : m_workers(0), m_pinToCores(false) {}
+
+        /////////////////////////////////////////////////
+        /// \brief Set the number of worker threads
+        ///
+        /// \param count Number of worker threads, 0 for one per CPU core except one
+        ///
+        /// \return Options with the number of workers
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr JobSystemOptions& workers(unsigned int count) { m_workers = count; return *this; }
+
+        /////////////////////////////////////////////////
+        /// \brief Run each worker thread on its own CPU core
+        ///
+        /// Pinning avoids moving the threads between cores, but a pinned
+        /// thread cannot use another core when its own is busy. It is
+        /// only supported on Linux and Windows.
+        ///
+        /// \param enabled True to pin the threads
+        ///
+        /// \return Options with the pinning
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr JobSystemOptions& pinToCores(bool enabled = true) { m_pinToCores = enabled; return *this; }
+
+    private:
+
+        unsigned int m_workers; ///< Number of worker threads, 0 for one per core except one
+        bool m_pinToCores;      ///< Are the threads pinned to cores?
+};
+
+}
+
+#endif // IKSDL_JOB_SYSTEM_OPTIONS_HPP
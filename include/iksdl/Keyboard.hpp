@@ -25,6 +25,7 @@
 
 #include "iksdl/iksdl_export.hpp"
 #include <SDL.h>
+#include <cstddef>
 #include <utility>
 
 namespace iksdl
@@ -53,6 +54,8 @@ class Keyboard
             PageUp, PageDown, Pause, PrintScreen, RightAlt, RightCtrl, Return, RightShift, ScrollLock, Space, Tab
         };
 
+        static constexpr size_t KEY_COUNT = static_cast<size_t>(Key::Tab) + 1; ///< Number of keys
+
         /////////////////////////////////////////////////
         /// \brief Check whether a key is pressed
         ///
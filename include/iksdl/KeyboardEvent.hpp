@@ -27,7 +27,7 @@
 #include "iksdl/EventHandler.hpp"
 #include "iksdl/Keyboard.hpp"
 #include "iksdl/iksdl_export.hpp"
-#include <vector>
+#include <cstdint>
 
 extern "C"
 {
@@ -40,7 +40,7 @@ namespace iksdl
 /////////////////////////////////////////////////
 /// \brief Represents an event related to the keyboard
 /////////////////////////////////////////////////
-class KeyboardEvent : public AbstractEvent
+class KeyboardEvent final : public AbstractEvent
 {
     public:
 
@@ -104,7 +104,39 @@ class KeyboardEvent : public AbstractEvent
         ///
         /// \return True if the modifier is active
         /////////////////////////////////////////////////
-        IKSDL_EXPORT inline bool hasModifier(Modifier modifier) const { return std::find(m_modifiers.begin(), m_modifiers.end(), modifier) != m_modifiers.end(); }
+        IKSDL_EXPORT inline bool hasModifier(Modifier modifier) const { return (m_modifiers & toMask(modifier)) != 0; }
+
+        /////////////////////////////////////////////////
+        /// \brief Are all the given modifiers active in the event?
+        ///
+        /// \param modifiers Combination of modifier masks to check
+        ///
+        /// \return True if all the modifiers are active
+        ///
+        /// \see toMask
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline bool hasModifiers(uint16_t modifiers) const { return (m_modifiers & modifiers) == modifiers; }
+
+        /////////////////////////////////////////////////
+        /// \brief Get all the modifiers active in the event
+        ///
+        /// \return Combination of the masks of the active modifiers
+        ///
+        /// \see toMask
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline uint16_t getModifiers() const { return m_modifiers; }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the mask of a modifier
+        ///
+        /// Masks can be combined with a bitwise or, to check
+        /// several modifiers at once.
+        ///
+        /// \param modifier Modifier
+        ///
+        /// \return Mask of the modifier
+        /////////////////////////////////////////////////
+        static constexpr uint16_t toMask(Modifier modifier) { return static_cast<uint16_t>(1u << static_cast<unsigned int>(modifier)); }
 
         /////////////////////////////////////////////////
         /// \brief Is the event repeating?
@@ -115,11 +147,11 @@ class KeyboardEvent : public AbstractEvent
 
     private:
 
-        Type m_type;                       ///< Keyboard event type
-        KeyState m_keyState;               ///< State of the key
-        Keyboard::Key m_key;               ///< Key that the event is about
-        std::vector<Modifier> m_modifiers; ///< List of active modifiers
-        bool m_repeat;                     ///< Is the event repeating?
+        Type m_type;          ///< Keyboard event type
+        KeyState m_keyState;  ///< State of the key
+        Keyboard::Key m_key;  ///< Key that the event is about
+        uint16_t m_modifiers; ///< Masks of the active modifiers
+        bool m_repeat;        ///< Is the event repeating?
 };
 
 }
@@ -26,6 +26,7 @@
 #include "iksdl/Drawable.hpp"
 #include "iksdl/Position.hpp"
 #include "iksdl/Color.hpp"
+#include <SDL.h>
 
 namespace iksdl
 {
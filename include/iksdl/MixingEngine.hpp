@@ -0,0 +1,109 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_MIXING_ENGINE_HPP
+#define IKSDL_MIXING_ENGINE_HPP
+
+#include "iksdl/iksdl_export.hpp"
+#include <chrono>
+
+namespace iksdl
+{
+
+/////////////////////////////////////////////////
+/// \brief Optional engine mixing the sounds instead of SDL_mixer
+///
+/// SDL_mixer mixes its channels one sample at a time. With
+/// many sounds played at once, this engine is much faster: it
+/// mixes all the sounds by blocks with vectorized code chosen
+/// according to the CPU.
+///
+/// Once installed, the sounds played with \a Sound are mixed
+/// by the engine and the other features of the library work the
+/// same way. The music is still played by SDL_mixer.
+///
+/// The engine requires an audio device opened with 16-bit
+/// or float samples, in mono or stereo.
+///
+/// \see Sound, Voice
+/////////////////////////////////////////////////
+class MixingEngine
+{
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Mix the next played sounds with the engine
+        ///
+        /// The sounds already playing keep being mixed by SDL_mixer.
+        ///
+        /// This method will throw \a SdlException if the audio device
+        /// is not opened, or if its format is not supported.
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static void install();
+
+        /////////////////////////////////////////////////
+        /// \brief Stop the sounds mixed by the engine and mix the next ones with SDL_mixer
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static void uninstall();
+
+        /////////////////////////////////////////////////
+        /// \brief Is the engine installed?
+        ///
+        /// \return True if the sounds are mixed by the engine
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static bool isInstalled();
+
+        /////////////////////////////////////////////////
+        /// \brief Get the time spent mixing during the last audio callback
+        ///
+        /// \return CPU time of the last mixing
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static std::chrono::nanoseconds getLastMixDuration();
+
+        /////////////////////////////////////////////////
+        /// \brief Get the longest time spent mixing during an audio callback
+        ///
+        /// \return CPU time of the longest mixing since the installation or the last reset
+        ///
+        /// \see resetPeakMixDuration
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static std::chrono::nanoseconds getPeakMixDuration();
+
+        /////////////////////////////////////////////////
+        /// \brief Reset the longest time spent mixing
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static void resetPeakMixDuration();
+
+        /////////////////////////////////////////////////
+        /// \brief Get the part of the audio thread's time spent mixing
+        ///
+        /// If the load gets close to 1, the audio thread may not
+        /// be able to mix the sounds in time and the audio will stutter.
+        ///
+        /// \return Time spent in the last mixing divided by the duration of the mixed audio
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static double getMixLoad();
+};
+
+}
+
+#endif // IKSDL_MIXING_ENGINE_HPP
@@ -25,6 +25,7 @@
 
 #include "iksdl/Position.hpp"
 #include "iksdl/iksdl_export.hpp"
+#include <cstddef>
 
 namespace iksdl
 {
@@ -41,6 +42,8 @@ class Mouse
         /////////////////////////////////////////////////
         enum class Button { Left, Middle, Right, X1, X2 };
 
+        static constexpr size_t BUTTON_COUNT = static_cast<size_t>(Button::X2) + 1; ///< Number of buttons
+
         /////////////////////////////////////////////////
         /// \brief Check whether a button is pressed
         ///
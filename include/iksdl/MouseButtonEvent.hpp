@@ -41,7 +41,7 @@ namespace iksdl
 /////////////////////////////////////////////////
 /// \brief Represents an event related to mouse buttons
 /////////////////////////////////////////////////
-class MouseButtonEvent: public AbstractEvent
+class MouseButtonEvent final : public AbstractEvent
 {
     public:
 
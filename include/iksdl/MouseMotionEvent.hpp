@@ -39,7 +39,7 @@ namespace iksdl
 /////////////////////////////////////////////////
 /// \brief Represents an event related to a mouse movement
 /////////////////////////////////////////////////
-class MouseMotionEvent: public AbstractEvent
+class MouseMotionEvent final : public AbstractEvent
 {
     public:
 
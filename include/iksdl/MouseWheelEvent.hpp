@@ -39,7 +39,7 @@ namespace iksdl
 /////////////////////////////////////////////////
 /// \brief Represents an event related to mouse wheel
 /////////////////////////////////////////////////
-class MouseWheelEvent: public AbstractEvent
+class MouseWheelEvent final : public AbstractEvent
 {
     public:
 
@@ -112,6 +112,11 @@ class Music
 
     private:
 
+        /////////////////////////////////////////////////
+        /// \brief Free the music and release the audio device
+        /////////////////////////////////////////////////
+        void free();
+
         Mix_Music* m_music; ///< SDL music that can be played
 };
 
@@ -0,0 +1,185 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_PARTICLE_SYSTEM_HPP
+#define IKSDL_PARTICLE_SYSTEM_HPP
+
+#include "iksdl/Color.hpp"
+#include "iksdl/Drawable.hpp"
+#include "iksdl/Position.hpp"
+#include "iksdl/iksdl_export.hpp"
+#include <SDL.h>
+#include <chrono>
+#include <vector>
+
+namespace iksdl
+{
+
+class Texture;
+
+/////////////////////////////////////////////////
+/// \brief Particles emitted from one source and drawn together
+///
+/// Each particle is a square with a position, a velocity, a
+/// remaining life, a color and a size. The state of all the particles
+/// is stored in separate contiguous arrays, which are integrated in a
+/// single vectorized loop. The particles are drawn with a single call,
+/// either as plain colored squares or with a texture stretched on them.
+///
+/// The dead particles are replaced by the last ones, so the drawing
+/// order of the particles is not kept. Additive blending, which is
+/// the usual choice for fire and sparks, does not depend on this order.
+///
+/// The number of particles is limited to the capacity given at
+/// construction, so that no memory is allocated while emitting.
+/////////////////////////////////////////////////
+class ParticleSystem : public Drawable
+{
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Ways of blending the particles with what is already drawn
+        /////////////////////////////////////////////////
+        enum class Blending
+        {
+            Alpha,   ///< Particles are drawn over, according to their transparency
+            Additive ///< Particle colors are added, brightening what is below
+        };
+
+        /////////////////////////////////////////////////
+        /// \brief Constructor for particles drawn as colored squares
+        ///
+        /// \param capacity Maximum number of particles alive at the same time
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT explicit ParticleSystem(size_t capacity);
+
+        /////////////////////////////////////////////////
+        /// \brief Constructor for particles drawn with a texture
+        ///
+        /// The texture is modulated by the color of each particle.
+        /// It must not be destroyed while a particle system is using it.
+        ///
+        /// \param texture  Texture drawn on each particle
+        /// \param capacity Maximum number of particles alive at the same time
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT ParticleSystem(const Texture& texture, size_t capacity);
+
+        /////////////////////////////////////////////////
+        /// \brief Add a particle
+        ///
+        /// \param position Position of the center of the particle
+        /// \param velocity Movement of the particle per second
+        /// \param lifetime Duration of the life of the particle
+        /// \param color    Color of the particle
+        /// \param size     Width and height of the particle
+        ///
+        /// \return False if the capacity is reached or if the lifetime is not positive, the particle is not added then
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT bool emit(const Positionf& position, const Positionf& velocity, std::chrono::nanoseconds lifetime,
+                               const Color& color, float size);
+
+        /////////////////////////////////////////////////
+        /// \brief Move the particles and remove the dead ones
+        ///
+        /// \param elapsed Time elapsed since the last update
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void update(std::chrono::nanoseconds elapsed);
+
+        /////////////////////////////////////////////////
+        /// \brief Remove all the particles
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void clear();
+
+        /////////////////////////////////////////////////
+        /// \brief Draw all the particles
+        ///
+        /// \param renderer Renderer that will handle the drawing
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT virtual void draw(SDL_Renderer* const renderer) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Change the acceleration applied to all the particles
+        ///
+        /// \param gravity Change of velocity per second
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline void setGravity(const Positionf& gravity) { m_gravity = gravity; }
+
+        /////////////////////////////////////////////////
+        /// \brief Change the way the particles are blended
+        ///
+        /// \param blending New blending
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline void setBlending(Blending blending) { m_blending = blending; }
+
+        /////////////////////////////////////////////////
+        /// \brief Make the particles fade out as they get old
+        ///
+        /// When enabled, the transparency of a particle decreases
+        /// linearly from its color's alpha to zero over its lifetime.
+        ///
+        /// \param fading True to fade out the particles
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline void setFading(bool fading) { m_fading = fading; }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the acceleration applied to all the particles
+        ///
+        /// \return Change of velocity per second
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline const Positionf& getGravity() const { return m_gravity; }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of living particles
+        ///
+        /// \return Number of particles
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline size_t getParticlesCount() const { return m_x.size(); }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the maximum number of particles
+        ///
+        /// \return Maximum number of particles alive at the same time
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline size_t getCapacity() const { return m_capacity; }
+
+    private:
+
+        const Texture* m_texture;                   ///< Texture drawn on each particle, or nullptr for plain squares
+        size_t m_capacity;                          ///< Maximum number of particles
+        Positionf m_gravity;                        ///< Acceleration applied to all the particles, per second
+        Blending m_blending;                        ///< Blending of the particles
+        bool m_fading;                              ///< Do the particles fade out as they get old?
+        std::vector<float> m_x;                     ///< Position of each particle on X axis
+        std::vector<float> m_y;                     ///< Position of each particle on Y axis
+        std::vector<float> m_velocityX;             ///< Velocity of each particle on X axis, per second
+        std::vector<float> m_velocityY;             ///< Velocity of each particle on Y axis, per second
+        std::vector<float> m_life;                  ///< Remaining life of each particle, in seconds
+        std::vector<float> m_inverseLifetime;       ///< Inverse of the lifetime of each particle, in seconds
+        std::vector<float> m_size;                  ///< Size of each particle
+        std::vector<SDL_Color> m_colors;            ///< Color of each particle
+        std::vector<int> m_indices;                 ///< Triangles drawing the quads of all the particles
+        mutable std::vector<SDL_Vertex> m_vertices; ///< Quads drawing the particles, built when drawing
+};
+
+}
+
+#endif // IKSDL_PARTICLE_SYSTEM_HPP
@@ -39,7 +39,7 @@ namespace iksdl
 /////////////////////////////////////////////////
 /// \brief Represents a quit event
 /////////////////////////////////////////////////
-class QuitEvent: public AbstractEvent
+class QuitEvent final : public AbstractEvent
 {
     public:
 
@@ -0,0 +1,340 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_RENDER_COMMAND_LIST_HPP
+#define IKSDL_RENDER_COMMAND_LIST_HPP
+
+#include "iksdl/Color.hpp"
+#include "iksdl/Drawable.hpp"
+#include "iksdl/Line.hpp"
+#include "iksdl/Point.hpp"
+#include "iksdl/Rect.hpp"
+#include "iksdl/iksdl_export.hpp"
+#include <SDL.h>
+#include <cstdint>
+#include <vector>
+
+namespace iksdl
+{
+
+class Texture;
+class Sprite;
+class Spritef;
+class AbstractRectangle;
+class AbstractRectanglef;
+class AbstractRectangleArray;
+class AbstractRectangleArrayf;
+class Rectangle;
+class Rectanglef;
+class FillRectangle;
+class FillRectanglef;
+class RectangleArray;
+class RectangleArrayf;
+class FillRectangleArray;
+class FillRectangleArrayf;
+
+/////////////////////////////////////////////////
+/// \brief Draw commands recorded to be executed later
+///
+/// Recording a drawable copies its current state into the list,
+/// so the drawable can be changed or destroyed as soon as it is
+/// recorded. This allows a thread to build the next frame while
+/// the main thread draws the current one.
+///
+/// The textures used by the recorded sprites are not copied, so
+/// they must stay alive and unchanged until the list is drawn.
+///
+/// The list is drawn like any other entity, by giving it to
+/// \a Renderer::draw, which executes all the commands in order.
+///
+/// Several lists can be recorded at the same time by different
+/// threads, then merged into one list ordered by the sort keys
+/// of the commands.
+///
+/// \see RenderQueue
+/////////////////////////////////////////////////
+class RenderCommandList : public Drawable
+{
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Default constructor, making an empty list
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT RenderCommandList();
+
+        /////////////////////////////////////////////////
+        /// \brief Record the clearing of the rendering area
+        ///
+        /// \param clearColor Color that will fill the cleaned area
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void clear(const Color& clearColor = Color(0, 0, 0));
+
+        /////////////////////////////////////////////////
+        /// \brief Record a change of the viewport
+        ///
+        /// \param viewport New viewport
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void setViewport(const Recti& viewport);
+
+        /////////////////////////////////////////////////
+        /// \brief Record a change to the default viewport
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void resetViewport();
+
+        /////////////////////////////////////////////////
+        /// \brief Record the drawing of a sprite
+        ///
+        /// \param sprite Sprite to draw
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void record(const Sprite& sprite);
+
+        /////////////////////////////////////////////////
+        /// \brief Record the drawing of a sprite
+        ///
+        /// \param sprite Sprite to draw
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void record(const Spritef& sprite);
+
+        /////////////////////////////////////////////////
+        /// \brief Record the drawing of a rectangle
+        ///
+        /// \param rectangle Rectangle to draw
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void record(const Rectangle& rectangle);
+
+        /////////////////////////////////////////////////
+        /// \brief Record the drawing of a rectangle
+        ///
+        /// \param rectangle Rectangle to draw
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void record(const Rectanglef& rectangle);
+
+        /////////////////////////////////////////////////
+        /// \brief Record the drawing of a filled rectangle
+        ///
+        /// \param rectangle Rectangle to draw
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void record(const FillRectangle& rectangle);
+
+        /////////////////////////////////////////////////
+        /// \brief Record the drawing of a filled rectangle
+        ///
+        /// \param rectangle Rectangle to draw
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void record(const FillRectanglef& rectangle);
+
+        /////////////////////////////////////////////////
+        /// \brief Record the drawing of a rectangle array
+        ///
+        /// \param rectangles Rectangles to draw
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void record(const RectangleArray& rectangles);
+
+        /////////////////////////////////////////////////
+        /// \brief Record the drawing of a rectangle array
+        ///
+        /// \param rectangles Rectangles to draw
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void record(const RectangleArrayf& rectangles);
+
+        /////////////////////////////////////////////////
+        /// \brief Record the drawing of a filled rectangle array
+        ///
+        /// \param rectangles Rectangles to draw
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void record(const FillRectangleArray& rectangles);
+
+        /////////////////////////////////////////////////
+        /// \brief Record the drawing of a filled rectangle array
+        ///
+        /// \param rectangles Rectangles to draw
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void record(const FillRectangleArrayf& rectangles);
+
+        /////////////////////////////////////////////////
+        /// \brief Record the drawing of a line
+        ///
+        /// \param line Line to draw
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void record(const Line& line);
+
+        /////////////////////////////////////////////////
+        /// \brief Record the drawing of a line
+        ///
+        /// \param line Line to draw
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void record(const Linef& line);
+
+        /////////////////////////////////////////////////
+        /// \brief Record the drawing of a point
+        ///
+        /// \param point Point to draw
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void record(const Point& point);
+
+        /////////////////////////////////////////////////
+        /// \brief Record the drawing of a point
+        ///
+        /// \param point Point to draw
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void record(const Pointf& point);
+
+        /////////////////////////////////////////////////
+        /// \brief Append the commands of other lists, ordered by their sort keys
+        ///
+        /// Commands with the same key keep the order of the lists, then
+        /// their recording order, so the result only depends on the
+        /// content of the lists and not on the threads that recorded them.
+        ///
+        /// The merged commands are drawn after the commands already in
+        /// this list, whatever their keys.
+        ///
+        /// \param lists Lists to merge
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void merge(const std::vector<RenderCommandList>& lists);
+
+        /////////////////////////////////////////////////
+        /// \brief Remove all the recorded commands
+        ///
+        /// The memory is kept to record the next frame without allocating.
+        /// The sort key goes back to 0.
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void reset();
+
+        /////////////////////////////////////////////////
+        /// \brief Get the sort key given to the recorded commands
+        ///
+        /// \return Current sort key
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline uint64_t getSortKey() const { return m_sortKey; }
+
+        /////////////////////////////////////////////////
+        /// \brief Change the sort key given to the next recorded commands
+        ///
+        /// The keys decide the drawing order when lists are merged,
+        /// lower keys being drawn first. They can encode a layer, a
+        /// depth or a texture, for example.
+        ///
+        /// \param key New sort key
+        ///
+        /// \see merge
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline void setSortKey(uint64_t key) { m_sortKey = key; }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of recorded commands
+        ///
+        /// \return Number of commands
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline size_t getCommandsCount() const { return m_commands.size(); }
+
+        /////////////////////////////////////////////////
+        /// \brief Is the list empty?
+        ///
+        /// \return True if no command is recorded
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline bool isEmpty() const { return m_commands.empty(); }
+
+        /////////////////////////////////////////////////
+        /// \brief Execute all the recorded commands
+        ///
+        /// This must be called from the thread that owns the renderer.
+        ///
+        /// \param renderer Renderer that will handle the drawing
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT virtual void draw(SDL_Renderer* const renderer) const;
+
+    private:
+
+        /////////////////////////////////////////////////
+        /// \brief A recorded command, only made of plain data
+        /////////////////////////////////////////////////
+        struct Command
+        {
+            enum class Type : uint8_t { Clear, Viewport, ResetViewport, Sprite, Rects, FillRects, Lines, Points };
+
+            Type type;              ///< Kind of command
+            bool hasSource;         ///< Does the sprite draw a part of its texture?
+            bool hasCenter;         ///< Does the sprite have a rotation center?
+            SDL_RendererFlip flip;  ///< Flip of the sprite
+            SDL_Color color;        ///< Drawing color
+            const Texture* texture; ///< Texture of the sprite
+            SDL_Rect source;        ///< Part of the texture to draw, or viewport
+            SDL_FRect destination;  ///< Position and size of the sprite
+            SDL_FPoint center;      ///< Rotation center of the sprite
+            double rotation;        ///< Rotation of the sprite
+            uint32_t first;         ///< Index of the first rectangle or point used by the command
+            uint32_t count;         ///< Number of rectangles or points used by the command
+            uint64_t key;           ///< Sort key
+        };
+
+        /////////////////////////////////////////////////
+        /// \brief Add a command drawing with a color
+        ///
+        /// \param type  Kind of command
+        /// \param color Drawing color
+        /// \param first Index of the first rectangle or point used by the command
+        /// \param count Number of rectangles or points used by the command
+        /////////////////////////////////////////////////
+        void push(Command::Type type, const Color& color, size_t first, size_t count);
+
+        /////////////////////////////////////////////////
+        /// \brief Record a rectangle using \c int coordinates
+        ///
+        /// \param rectangle Rectangle to draw
+        /// \param type      Kind of command
+        /////////////////////////////////////////////////
+        void recordRectangle(const AbstractRectangle& rectangle, Command::Type type);
+
+        /////////////////////////////////////////////////
+        /// \brief Record a rectangle using \c float coordinates
+        ///
+        /// \param rectangle Rectangle to draw
+        /// \param type      Kind of command
+        /////////////////////////////////////////////////
+        void recordRectangle(const AbstractRectanglef& rectangle, Command::Type type);
+
+        /////////////////////////////////////////////////
+        /// \brief Record a rectangle array using \c int coordinates
+        ///
+        /// \param rectangles Rectangles to draw
+        /// \param type       Kind of command
+        /////////////////////////////////////////////////
+        void recordRectangles(const AbstractRectangleArray& rectangles, Command::Type type);
+
+        /////////////////////////////////////////////////
+        /// \brief Record a rectangle array using \c float coordinates
+        ///
+        /// \param rectangles Rectangles to draw
+        /// \param type       Kind of command
+        /////////////////////////////////////////////////
+        void recordRectangles(const AbstractRectangleArrayf& rectangles, Command::Type type);
+
+        std::vector<Command> m_commands;  ///< Recorded commands
+        std::vector<SDL_FRect> m_rects;   ///< Rectangles used by the commands
+        std::vector<SDL_FPoint> m_points; ///< Points used by the commands
+        uint64_t m_sortKey;               ///< Sort key given to the recorded commands
+};
+
+}
+
+#endif // IKSDL_RENDER_COMMAND_LIST_HPP
@@ -0,0 +1,159 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_RENDER_QUEUE_HPP
+#define IKSDL_RENDER_QUEUE_HPP
+
+#include "iksdl/RenderCommandList.hpp"
+#include "iksdl/iksdl_export.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace iksdl
+{
+
+class Renderer;
+
+/////////////////////////////////////////////////
+/// \brief Buffered command lists passing frames from a game thread to the main thread
+///
+/// SDL can only draw from the main thread. With this queue, a game
+/// thread records the commands of the next frame while the main
+/// thread executes the commands of the current one, so simulation
+/// and rendering run at the same time on two cores.
+///
+/// With two lists, the game thread can record one frame ahead of
+/// the rendering. With three lists, it can record two frames ahead,
+/// which absorbs the frames that take longer to simulate.
+///
+/// The frames are always executed in the order they were submitted.
+///
+/// The commands of a frame can also be recorded by several jobs at
+/// once, each one into its own buffer, which are then merged by sort
+/// key into the list of the frame.
+///
+/// \see RenderCommandList
+/////////////////////////////////////////////////
+class RenderQueue
+{
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Constructor
+        ///
+        /// This constructor will throw \a InvalidParameterException
+        /// if the number of lists is not 2 or 3.
+        ///
+        /// \param listsCount Number of command lists, 2 for double buffering or 3 for triple buffering
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT explicit RenderQueue(size_t listsCount = 2);
+
+        RenderQueue(const RenderQueue&) = delete;
+        RenderQueue& operator=(const RenderQueue&) = delete;
+
+        /////////////////////////////////////////////////
+        /// \brief Get an empty list to record the next frame, from the game thread
+        ///
+        /// Waits until the main thread has executed a list if they are all in use.
+        ///
+        /// \return List to record into, or nullptr if the queue is closed
+        ///
+        /// \see submit
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT RenderCommandList* beginRecording();
+
+        /////////////////////////////////////////////////
+        /// \brief Record commands in parallel into the list being recorded, from the game thread
+        ///
+        /// The recorder is called once for each buffer, on the workers of
+        /// the \a JobSystem. Each call gets its own buffer, so buffers are
+        /// best split by spatial region or by system. Once all the buffers
+        /// are recorded, they are merged into the list by sort key, so the
+        /// frame does not depend on which thread recorded which buffer.
+        ///
+        /// Does nothing if no list is being recorded.
+        ///
+        /// \param buffersCount Number of buffers to record
+        /// \param recorder     Called with the index of a buffer and the buffer to record into
+        ///
+        /// \see beginRecording, RenderCommandList::merge, RenderCommandList::setSortKey
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void recordParallel(size_t buffersCount, const std::function<void(size_t, RenderCommandList&)>& recorder);
+
+        /////////////////////////////////////////////////
+        /// \brief Give the recorded list to the main thread, from the game thread
+        ///
+        /// Does nothing if no list is being recorded.
+        ///
+        /// \see beginRecording
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void submit();
+
+        /////////////////////////////////////////////////
+        /// \brief Execute the oldest submitted list, from the main thread
+        ///
+        /// \param renderer Renderer that will handle the drawing
+        /// \param timeout  Maximum time to wait for a list to be submitted
+        ///
+        /// \return False if no list was submitted before the timeout, or if the queue is closed
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT bool execute(Renderer& renderer, std::chrono::nanoseconds timeout = std::chrono::nanoseconds(0));
+
+        /////////////////////////////////////////////////
+        /// \brief Close the queue, waking up both threads
+        ///
+        /// Once closed, \a beginRecording returns nullptr and \a execute
+        /// returns false, so that the threads can stop.
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void close();
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of submitted lists waiting to be executed
+        ///
+        /// \return Number of pending lists
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT size_t getPendingCount() const;
+
+    private:
+
+        static constexpr std::string_view LISTS_COUNT_ERROR = "A render queue must have 2 or 3 command lists";
+
+        std::vector<RenderCommandList> m_lists;   ///< Command lists
+        std::vector<RenderCommandList> m_buffers; ///< Buffers for the parallel recording, only used by the game thread
+        std::vector<size_t> m_free;               ///< Indices of the lists that can be recorded
+        std::deque<size_t> m_submitted;           ///< Indices of the lists waiting to be executed, oldest first
+        size_t m_recording;                       ///< Index of the list being recorded, or the number of lists if none
+        bool m_closed;                            ///< Is the queue closed?
+        mutable std::mutex m_mutex;               ///< Protects the state of the lists
+        std::condition_variable m_freed;          ///< Signaled when a list can be recorded
+        std::condition_variable m_filled;         ///< Signaled when a list is submitted
+};
+
+}
+
+#endif // IKSDL_RENDER_QUEUE_HPP
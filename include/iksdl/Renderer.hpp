@@ -122,6 +122,7 @@ class Renderer
 
         SDL_Renderer* m_renderer; ///< SDL renderer
         SDL_Rect m_viewport;      ///< Current viewport
+        bool m_software;          ///< Is the rendering done by software?
 };
 
 }
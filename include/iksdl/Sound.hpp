@@ -23,11 +23,12 @@
 #ifndef IKSDL_SOUND_HPP
 #define IKSDL_SOUND_HPP
 
-#include "iksdl/Channels.hpp"
+#include "iksdl/SoundPolicy.hpp"
+#include "iksdl/Voice.hpp"
+#include "iksdl/Voices.hpp"
 #include "iksdl_export.hpp"
 #include <SDL_mixer.h>
 #include <string>
-#include <optional>
 #include <chrono>
 
 namespace iksdl
@@ -52,9 +53,13 @@ class Sound
         ///
         /// Supported formats: WAVE, AIFF, RIFF, OGG, VOC
         ///
+        /// The whole sound is decoded by this constructor, use
+        /// \a AudioLoader to load it in the background.
+        ///
         /// \param filePath Path to audio file
+        /// \param policy   Limits applied when playing the sound
         /////////////////////////////////////////////////
-        IKSDL_EXPORT explicit Sound(const std::string& filePath);
+        IKSDL_EXPORT explicit Sound(const std::string& filePath, const SoundPolicy& policy = SoundPolicy());
 
         Sound(const Sound&) = delete;
 
@@ -89,8 +94,12 @@ class Sound
         /// When \a loops is set to -1, the sound will be infinitely repeated.
         ///
         /// \param loops Number of times to play the sound
+        ///
+        /// \return Voice of this play, invalid if the sound was not played because of its policy or the voice limits
+        ///
+        /// \see SoundPolicy, VoiceManager
         /////////////////////////////////////////////////
-        IKSDL_EXPORT void play(int loops = 0);
+        IKSDL_EXPORT Voice play(int loops = 0);
 
         /////////////////////////////////////////////////
         /// \brief Play the sound for a limited amount of time
@@ -102,50 +111,75 @@ class Sound
         ///
         /// \param time  Maximum time to play the sound
         /// \param loops Maximum number of times to play the sound
+        ///
+        /// \return Voice of this play, invalid if the sound was not played because of its policy or the voice limits
+        ///
+        /// \see SoundPolicy, VoiceManager
         /////////////////////////////////////////////////
-        IKSDL_EXPORT void play(std::chrono::milliseconds time, int loops = 0);
+        IKSDL_EXPORT Voice play(std::chrono::milliseconds time, int loops = 0);
 
         /////////////////////////////////////////////////
-        /// \brief Pause the sound
+        /// \brief Change the limits applied when playing the sound
+        ///
+        /// \param policy New limits, applied to the next plays of the sound
         /////////////////////////////////////////////////
-        inline void pause() const { if(m_channel.has_value()) Mix_Pause(m_channel.value()); }
+        inline void setPolicy(const SoundPolicy& policy) { m_voiceGroup.policy = policy; }
 
         /////////////////////////////////////////////////
-        /// \brief Resume the sound
+        /// \brief Pause the last play of the sound
+        ///
+        /// Use the voices returned by \a play to pause the other plays.
         /////////////////////////////////////////////////
-        inline void resume() const { if(m_channel.has_value()) Mix_Resume(m_channel.value()); }
+        inline void pause() const { m_lastVoice.pause(); }
+
+        /////////////////////////////////////////////////
+        /// \brief Resume the last play of the sound
+        /////////////////////////////////////////////////
+        inline void resume() const { m_lastVoice.resume(); }
+
+        /////////////////////////////////////////////////
+        /// \brief Stop all the plays of the sound
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void stop();
 
         /////////////////////////////////////////////////
         /// \brief Change the sound volume
         ///
+        /// This volume applies to all the plays of the sound.
+        ///
         /// \param volume New volume, between 0 and 128
         /////////////////////////////////////////////////
-        inline void setVolume(int volume) const { Mix_VolumeChunk(m_chunk, volume); }
+        IKSDL_EXPORT void setVolume(int volume) const;
 
         /////////////////////////////////////////////////
-        /// \brief Is the sound currently being played?
+        /// \brief Is the last play of the sound currently being played?
         ///
         /// \return True if the sound is playing
         /////////////////////////////////////////////////
-        inline bool isPlaying() const { return m_channel.has_value() && Mix_Playing(m_channel.value()) != 0; }
+        inline bool isPlaying() const { return m_lastVoice.isPlaying(); }
 
         /////////////////////////////////////////////////
-        /// \brief Is the sound currently paused?
+        /// \brief Is the last play of the sound currently paused?
         ///
         /// \return True if the sound is paused
         /////////////////////////////////////////////////
-        inline bool isPaused() const { return m_channel.has_value() && Mix_Paused(m_channel.value()) != 0; }
+        inline bool isPaused() const { return m_lastVoice.isPaused(); }
 
         /////////////////////////////////////////////////
         /// \brief Pause all the sounds
         /////////////////////////////////////////////////
-        IKSDL_EXPORT static void pauseAll() { Mix_Pause(-1); }
+        IKSDL_EXPORT static void pauseAll();
 
     private:
 
-        priv::Channels* m_channels;   ///< Audio channels manager
-        Mix_Chunk* m_chunk;           ///< SDL sound that can be played
-        std::optional<int> m_channel; ///< Audio channel that the sound plays on
+        /////////////////////////////////////////////////
+        /// \brief Free the sound and release the audio device
+        /////////////////////////////////////////////////
+        void free();
+
+        Mix_Chunk* m_chunk;            ///< SDL sound that can be played
+        priv::VoiceGroup m_voiceGroup; ///< Voices playing the sound
+        Voice m_lastVoice;             ///< Voice of the last play of the sound
 };
 
 }
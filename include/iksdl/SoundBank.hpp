@@ -0,0 +1,119 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_SOUND_BANK_HPP
+#define IKSDL_SOUND_BANK_HPP
+
+#include "iksdl/Sound.hpp"
+#include "iksdl/iksdl_export.hpp"
+#include <string>
+#include <unordered_map>
+
+namespace iksdl
+{
+
+/////////////////////////////////////////////////
+/// \brief Stores sounds by name so that each file is decoded only once
+///
+/// A sound of the bank can be played by any number of entities
+/// at the same time. Each play returns its own \a Voice to control it.
+///
+/// The references to the sounds of the bank stay valid until
+/// they are unloaded or the bank is destroyed.
+/////////////////////////////////////////////////
+class SoundBank
+{
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Load a sound into the bank
+        ///
+        /// If a sound is already loaded with this name, it is returned
+        /// and the file is not loaded again.
+        ///
+        /// This method will throw \a InvalidParameterException if
+        /// the sound could not be loaded.
+        ///
+        /// \param name     Name of the sound in the bank
+        /// \param filePath Path to audio file
+        /// \param policy   Limits applied when playing the sound
+        ///
+        /// \return Loaded sound
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT Sound& load(const std::string& name, const std::string& filePath, const SoundPolicy& policy = SoundPolicy());
+
+        /////////////////////////////////////////////////
+        /// \brief Remove a sound from the bank
+        ///
+        /// All the plays of the sound are stopped.
+        ///
+        /// \param name Name of the sound in the bank
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void unload(const std::string& name);
+
+        /////////////////////////////////////////////////
+        /// \brief Is a sound loaded into the bank?
+        ///
+        /// \param name Name of the sound in the bank
+        ///
+        /// \return True if the sound is loaded
+        /////////////////////////////////////////////////
+        inline bool contains(const std::string& name) const { return m_sounds.contains(name); }
+
+        /////////////////////////////////////////////////
+        /// \brief Get a sound of the bank
+        ///
+        /// This method will throw \a InvalidParameterException if
+        /// no sound is loaded with this name.
+        ///
+        /// \param name Name of the sound in the bank
+        ///
+        /// \return Sound with this name
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT Sound& get(const std::string& name);
+
+        /////////////////////////////////////////////////
+        /// \brief Play a sound of the bank
+        ///
+        /// This method will throw \a InvalidParameterException if
+        /// no sound is loaded with this name.
+        ///
+        /// \param name  Name of the sound in the bank
+        /// \param loops Number of times to play the sound
+        ///
+        /// \return Voice of this play, invalid if the sound was not played
+        /////////////////////////////////////////////////
+        inline Voice play(const std::string& name, int loops = 0) { return get(name).play(loops); }
+
+        /////////////////////////////////////////////////
+        /// \brief Stop all the plays of all the sounds of the bank
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void stopAll();
+
+    private:
+
+        std::unordered_map<std::string, Sound> m_sounds; ///< Sounds by name
+};
+
+}
+
+#endif // IKSDL_SOUND_BANK_HPP
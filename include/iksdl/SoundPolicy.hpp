@@ -0,0 +1,99 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_SOUND_POLICY_HPP
+#define IKSDL_SOUND_POLICY_HPP
+
+#include "iksdl/iksdl_export.hpp"
+#include <chrono>
+
+namespace iksdl
+{
+
+namespace priv
+{
+class Voices;
+}
+
+/////////////////////////////////////////////////
+/// \brief Allows to limit how a sound uses the audio channels
+///
+/// This class works with builder methods, it is possible
+/// to chain the calls to build the full set of options
+///
+/// \see Sound, VoiceManager
+/////////////////////////////////////////////////
+class SoundPolicy
+{
+    friend class priv::Voices;
+
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Default constructor with no limit
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr SoundPolicy() : m_maxVoices(0), m_priority(0), m_retriggerWindow(0) {}
+
+        /////////////////////////////////////////////////
+        /// \brief Limit the number of times the sound can be played simultaneously
+        ///
+        /// When the limit is reached, playing the sound again
+        /// steals one of its voices according to the steal policy
+        /// of the \a VoiceManager.
+        ///
+        /// \param voices Maximum number of simultaneous voices, or 0 for no limit
+        ///
+        /// \return Options with the limit of voices
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr SoundPolicy& maxVoices(unsigned int voices) { m_maxVoices = voices; return *this; }
+
+        /////////////////////////////////////////////////
+        /// \brief Set the priority of the sound
+        ///
+        /// A voice can only be stolen by a sound with the same
+        /// or a higher priority.
+        ///
+        /// \param priority Priority of the sound, 0 by default
+        ///
+        /// \return Options with the priority
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr SoundPolicy& priority(int priority) { m_priority = priority; return *this; }
+
+        /////////////////////////////////////////////////
+        /// \brief Ignore the requests to play the sound that come too soon after the previous one
+        ///
+        /// \param window Minimum time between two starts of the sound, or 0 for no minimum
+        ///
+        /// \return Options with the retrigger window
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr SoundPolicy& retriggerWindow(std::chrono::milliseconds window) { m_retriggerWindow = window; return *this; }
+
+    private:
+
+        unsigned int m_maxVoices;                    ///< Maximum number of simultaneous voices, 0 for no limit
+        int m_priority;                              ///< Priority of the sound
+        std::chrono::milliseconds m_retriggerWindow; ///< Minimum time between two starts of the sound
+};
+
+}
+
+#endif // IKSDL_SOUND_POLICY_HPP
@@ -38,6 +38,8 @@ namespace iksdl
 /////////////////////////////////////////////////
 class Sprite : public BaseSprite
 {
+    friend class RenderCommandList;
+
     public:
 
         /////////////////////////////////////////////////
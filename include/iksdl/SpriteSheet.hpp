@@ -0,0 +1,214 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_SPRITE_SHEET_HPP
+#define IKSDL_SPRITE_SHEET_HPP
+
+#include "iksdl/Rect.hpp"
+#include "iksdl/Size.hpp"
+#include "iksdl/iksdl_export.hpp"
+#include <SDL.h>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace iksdl
+{
+
+class Texture;
+class AnimationSet;
+
+/////////////////////////////////////////////////
+/// \brief Frames of a texture and the animations playing them
+///
+/// The frames are parts of the texture, either cut from a uniform
+/// grid or added one by one. An animation is a sequence of frames,
+/// each one shown for its own duration.
+///
+/// The texture must not be destroyed while a sheet is using it.
+///
+/// \see AnimationSet
+/////////////////////////////////////////////////
+class SpriteSheet
+{
+    friend class AnimationSet;
+
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Constructor for a sheet without frames
+        ///
+        /// \param texture Texture containing the frames
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT explicit SpriteSheet(const Texture& texture);
+
+        /////////////////////////////////////////////////
+        /// \brief Add a frame
+        ///
+        /// This method will throw \a InvalidParameterException if
+        /// the frame is empty or not inside the texture.
+        ///
+        /// \param rect Part of the texture shown by the frame
+        ///
+        /// \return Reference to the sheet
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT SpriteSheet& addFrame(const Recti& rect);
+
+        /////////////////////////////////////////////////
+        /// \brief Add the frames of a uniform grid covering the texture
+        ///
+        /// The frames are added row by row, from the top-left corner.
+        /// The pixels that do not fill a whole frame on the right and
+        /// bottom borders are ignored.
+        ///
+        /// This method will throw \a InvalidParameterException if
+        /// the frame size is empty or larger than the texture.
+        ///
+        /// \param frameSize Size of each frame
+        ///
+        /// \return Reference to the sheet
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT SpriteSheet& addGrid(const Sizei& frameSize);
+
+        /////////////////////////////////////////////////
+        /// \brief Add an animation whose frames all have the same duration
+        ///
+        /// This method will throw \a InvalidParameterException if
+        /// the name is already used, if there are no frames, if a
+        /// frame does not exist or if the duration is not positive.
+        ///
+        /// \param name          Name of the animation
+        /// \param frames        Indices of the frames to show, in order
+        /// \param frameDuration Duration of each frame
+        /// \param loop          Does the animation start over once finished?
+        ///
+        /// \return Reference to the sheet
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT SpriteSheet& addAnimation(const std::string& name, const std::vector<size_t>& frames,
+                                               std::chrono::nanoseconds frameDuration, bool loop = true);
+
+        /////////////////////////////////////////////////
+        /// \brief Add an animation with a duration for each frame
+        ///
+        /// This method will throw \a InvalidParameterException if
+        /// the name is already used, if there are no frames, if a
+        /// frame does not exist or if a duration is not positive.
+        ///
+        /// \param name   Name of the animation
+        /// \param frames Indices of the frames to show with their durations, in order
+        /// \param loop   Does the animation start over once finished?
+        ///
+        /// \return Reference to the sheet
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT SpriteSheet& addAnimation(const std::string& name,
+                                               const std::vector<std::pair<size_t, std::chrono::nanoseconds>>& frames,
+                                               bool loop = true);
+
+        /////////////////////////////////////////////////
+        /// \brief Get the index of an animation
+        ///
+        /// This method will throw \a InvalidParameterException if
+        /// no animation has the given name.
+        ///
+        /// \param name Name of the animation
+        ///
+        /// \return Index of the animation
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT size_t getAnimation(const std::string& name) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Get the part of the texture shown by a frame
+        ///
+        /// \param index Index of the frame
+        ///
+        /// \return Position and size of the frame in the texture
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline Recti getFrame(size_t index) const
+        {
+            return Recti(m_frames[index].rect.x, m_frames[index].rect.y, m_frames[index].rect.w, m_frames[index].rect.h);
+        }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of frames
+        ///
+        /// \return Number of frames
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline size_t getFramesCount() const { return m_frames.size(); }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of animations
+        ///
+        /// \return Number of animations
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline size_t getAnimationsCount() const { return m_animations.size(); }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the texture containing the frames
+        ///
+        /// \return Texture of the sheet
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline const Texture& getTexture() const { return *m_texture; }
+
+    private:
+
+        /////////////////////////////////////////////////
+        /// \brief Part of the texture shown by a frame
+        /////////////////////////////////////////////////
+        struct Frame
+        {
+            SDL_Rect rect; ///< Position and size in the texture
+            SDL_FRect uv;  ///< Position and size in normalized texture coordinates
+        };
+
+        /////////////////////////////////////////////////
+        /// \brief Frame shown by an animation
+        /////////////////////////////////////////////////
+        struct Step
+        {
+            uint32_t frame; ///< Index of the frame
+            int64_t end;    ///< Time when the step ends, in nanoseconds since the animation start
+        };
+
+        /////////////////////////////////////////////////
+        /// \brief Sequence of steps
+        /////////////////////////////////////////////////
+        struct Animation
+        {
+            uint32_t first;   ///< Index of the first step
+            uint32_t count;   ///< Number of steps
+            int64_t duration; ///< Total duration, in nanoseconds
+            bool loop;        ///< Does the animation start over once finished?
+        };
+
+        const Texture* const m_texture;                  ///< Texture containing the frames
+        std::vector<Frame> m_frames;                     ///< Frames of the sheet
+        std::vector<Step> m_steps;                       ///< Steps of all the animations
+        std::vector<Animation> m_animations;             ///< Animations of the sheet
+        std::unordered_map<std::string, size_t> m_names; ///< Indices of the animations by name
+};
+
+}
+
+#endif // IKSDL_SPRITE_SHEET_HPP
@@ -40,6 +40,8 @@ class Texture;
 /////////////////////////////////////////////////
 class Spritef : public BaseSprite
 {
+    friend class RenderCommandList;
+
     public:
 
         /////////////////////////////////////////////////
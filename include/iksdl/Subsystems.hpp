@@ -0,0 +1,93 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_SUBSYSTEMS_HPP
+#define IKSDL_SUBSYSTEMS_HPP
+
+#include "iksdl/iksdl_export.hpp"
+#include <chrono>
+
+namespace iksdl
+{
+
+/////////////////////////////////////////////////
+/// \brief Information about the SDL subsystems used by the library
+///
+/// The subsystems are initialized when they are first needed:
+/// the video with the first window, the fonts with the first
+/// \a Font, the audio device with the first \a Sound or \a Music
+/// (unless it was opened with \a AudioDevice), and each image
+/// codec with the first image of its format.
+///
+/// The video, fonts and audio are shut down when the last object
+/// using them is destroyed. The image codecs are shut down with
+/// the video.
+///
+/// \see Window, Font, Sound, Music, Texture
+/////////////////////////////////////////////////
+class Subsystems
+{
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Subsystems initialized on demand
+        /////////////////////////////////////////////////
+        enum class Type
+        {
+            Video,     ///< SDL video, needed by the windows
+            Audio,     ///< SDL audio and the audio device, needed by the sounds and musics
+            Fonts,     ///< SDL_ttf, needed by the fonts
+            PngCodec,  ///< SDL_image PNG decoder
+            JpgCodec,  ///< SDL_image JPG decoder
+            TifCodec,  ///< SDL_image TIF decoder
+            WebpCodec  ///< SDL_image WEBP decoder
+        };
+
+        /////////////////////////////////////////////////
+        /// \brief Is a subsystem currently initialized?
+        ///
+        /// \param type Subsystem to check
+        ///
+        /// \return True if the subsystem is initialized
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static bool isInitialized(Type type);
+
+        /////////////////////////////////////////////////
+        /// \brief Get the time spent initializing a subsystem
+        ///
+        /// \param type Subsystem to check
+        ///
+        /// \return Duration of the last initialization, or 0 if it was never initialized
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static std::chrono::nanoseconds getInitDuration(Type type);
+
+        /////////////////////////////////////////////////
+        /// \brief Get the time spent initializing all the subsystems
+        ///
+        /// \return Sum of the last initialization durations
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static std::chrono::nanoseconds getTotalInitDuration();
+};
+
+}
+
+#endif // IKSDL_SUBSYSTEMS_HPP
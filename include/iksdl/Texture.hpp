@@ -44,6 +44,11 @@ class Texture
 {
     friend class Sprite;
     friend class Spritef;
+    friend class AssetPreloader;
+    friend class AnimationSet;
+    friend class ParticleSystem;
+    friend class TileMap;
+    friend class RenderCommandList;
 
     public:
 
@@ -132,8 +137,44 @@ class Texture
 
     private:
 
+        /////////////////////////////////////////////////
+        /// \brief Constructor from an image already loaded in memory
+        ///
+        /// The surface is freed by this constructor. This constructor will
+        /// throw \a SdlException if the texture could not be created.
+        ///
+        /// \param renderer Renderer that will draw the texture
+        /// \param surface  Image loaded in memory
+        /// \param filePath Path to image file, for error reporting
+        /////////////////////////////////////////////////
+        Texture(const Renderer& renderer, SDL_Surface* surface, const std::string& filePath);
+
+        /////////////////////////////////////////////////
+        /// \brief Load an image in memory
+        ///
+        /// The image is only decoded, so it can be done on any thread.
+        ///
+        /// \param filePath Path to image file
+        ///
+        /// \return Loaded image, nullptr if it could not be loaded
+        /////////////////////////////////////////////////
+        static SDL_Surface* decode(const std::string& filePath);
+
+        /////////////////////////////////////////////////
+        /// \brief Create the texture from an image loaded in memory
+        ///
+        /// The surface is freed by this method. This method will
+        /// throw \a SdlException if the texture could not be created.
+        ///
+        /// \param renderer Renderer that will draw the texture
+        /// \param surface  Image loaded in memory
+        /// \param filePath Path to image file, for error reporting
+        /////////////////////////////////////////////////
+        void createFromSurface(const Renderer& renderer, SDL_Surface* surface, const std::string& filePath);
+
         SDL_Texture* m_texture; ///< SDL texture
         Sizei m_size;           ///< Texture size
+        SDL_Surface* m_pixels;  ///< Copy of the image in ARGB8888 format, only kept for the software renderer
 };
 
 }
@@ -0,0 +1,261 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_TILE_MAP_HPP
+#define IKSDL_TILE_MAP_HPP
+
+#include "iksdl/Drawable.hpp"
+#include "iksdl/Position.hpp"
+#include "iksdl/Size.hpp"
+#include "iksdl/iksdl_export.hpp"
+#include <SDL.h>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace iksdl
+{
+
+class Texture;
+
+/////////////////////////////////////////////////
+/// \brief A grid of tiles taken from a tileset texture
+///
+/// The tileset is cut into tiles of the same size, numbered row
+/// by row from its top-left corner. The map stores the number of
+/// the tile shown in each cell.
+///
+/// The map is split into chunks of cells. Only the chunks intersecting
+/// the viewport are drawn, each one with a single call. A chunk is
+/// drawn into a cached texture the first time it is visible, and is
+/// drawn again only when one of its tiles changes. When the renderer
+/// does not support render targets, the chunks cache their geometry
+/// instead.
+///
+/// The least recently drawn chunks leave the cache once it is full.
+///
+/// The tileset must not be destroyed while a map is using it, and the
+/// map must be destroyed before the renderer that drew it.
+/////////////////////////////////////////////////
+class TileMap : public Drawable
+{
+    public:
+
+        static constexpr uint16_t EMPTY_TILE = std::numeric_limits<uint16_t>::max(); ///< Tile number of the empty cells
+        static constexpr size_t DEFAULT_CACHE_SIZE = 64;                            ///< Default maximum number of cached chunks
+
+        /////////////////////////////////////////////////
+        /// \brief Constructor for a map with empty cells
+        ///
+        /// This constructor will throw \a InvalidParameterException if a
+        /// size is not positive or if the tiles are larger than the tileset.
+        ///
+        /// \param tileset   Texture containing the tiles
+        /// \param tileSize  Size of the tiles, in pixels
+        /// \param mapSize   Size of the map, in cells
+        /// \param chunkSize Size of the chunks, in cells
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT TileMap(const Texture& tileset, const Sizei& tileSize, const Sizei& mapSize,
+                             const Sizei& chunkSize = Sizei(32, 32));
+
+        TileMap(const TileMap&) = delete;
+
+        /////////////////////////////////////////////////
+        /// \brief Move constructor
+        ///
+        /// \param other Map to be moved
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT TileMap(TileMap&& other);
+
+        /////////////////////////////////////////////////
+        /// \brief Destructor
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT ~TileMap();
+
+        TileMap& operator=(const TileMap&) = delete;
+        TileMap& operator=(TileMap&&) = delete;
+
+        /////////////////////////////////////////////////
+        /// \brief Change the tile shown in a cell
+        ///
+        /// This method will throw \a InvalidParameterException if the
+        /// cell is outside of the map or if the tileset has no such tile.
+        ///
+        /// \param cell Position of the cell, in cells
+        /// \param tile Number of the tile, or \a EMPTY_TILE
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void setTile(const Positioni& cell, uint16_t tile);
+
+        /////////////////////////////////////////////////
+        /// \brief Change the tiles of all the cells
+        ///
+        /// This method will throw \a InvalidParameterException if the
+        /// number of tiles does not match the size of the map or if the
+        /// tileset has no such tile.
+        ///
+        /// \param tiles Numbers of the tiles, row by row from the top-left cell
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void setTiles(const std::vector<uint16_t>& tiles);
+
+        /////////////////////////////////////////////////
+        /// \brief Get the tile shown in a cell
+        ///
+        /// \param cell Position of the cell, in cells
+        ///
+        /// \return Number of the tile, or \a EMPTY_TILE
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline uint16_t getTile(const Positioni& cell) const
+        {
+            return m_tiles[static_cast<size_t>(cell.getY()) * static_cast<size_t>(m_mapSize.getWidth()) + static_cast<size_t>(cell.getX())];
+        }
+
+        /////////////////////////////////////////////////
+        /// \brief Move the map to another position
+        ///
+        /// The movement is relative to the current position.
+        ///
+        /// \param delta Movement to apply
+        ///
+        /// \see setPosition
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline void move(const Positionf& delta) { m_position = m_position + delta; }
+
+        /////////////////////////////////////////////////
+        /// \brief Change the position of the map
+        ///
+        /// \param position New position (top-left corner)
+        ///
+        /// \see move
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline void setPosition(const Positionf& position) { m_position = position; }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the position of the map
+        ///
+        /// \return Position of the map (top-left corner)
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline const Positionf& getPosition() const { return m_position; }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the size of the map
+        ///
+        /// \return Size of the map, in cells
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT inline const Sizei& getSize() const { return m_mapSize; }
+
+        /////////////////////////////////////////////////
+        /// \brief Change the maximum number of cached chunks
+        ///
+        /// The chunks visible in a frame are always drawn, even if
+        /// they do not all fit in the cache.
+        ///
+        /// \param chunks Maximum number of cached chunks
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void setCacheSize(size_t chunks);
+
+        /////////////////////////////////////////////////
+        /// \brief Draw all the chunks again on their next drawing
+        ///
+        /// This must be called when the renderer loses its render
+        /// targets, which is notified by a \c SDL_RENDER_TARGETS_RESET event.
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void invalidate();
+
+        /////////////////////////////////////////////////
+        /// \brief Draw the chunks intersecting the viewport
+        ///
+        /// \param renderer Renderer that will handle the drawing
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT virtual void draw(SDL_Renderer* const renderer) const;
+
+    private:
+
+        /////////////////////////////////////////////////
+        /// \brief Cached drawing of a part of the map
+        /////////////////////////////////////////////////
+        struct Chunk
+        {
+            SDL_Texture* texture;             ///< Tiles drawn in a texture, when render targets are supported
+            std::vector<SDL_Vertex> vertices; ///< Quads of the tiles, when render targets are not supported
+            uint64_t lastDrawn;               ///< Frame when the chunk was last drawn
+            bool cached;                      ///< Does the chunk hold a texture or vertices?
+            bool upToDate;                    ///< Does the cached drawing match the tiles?
+        };
+
+        /////////////////////////////////////////////////
+        /// \brief Write the quads of the tiles of a chunk, relative to the chunk
+        ///
+        /// \param chunk    Index of the chunk
+        /// \param vertices Vertices to fill
+        /////////////////////////////////////////////////
+        void buildChunk(size_t chunk, std::vector<SDL_Vertex>& vertices) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Make room for a chunk in the cache
+        ///
+        /// \return False if all the cached chunks are visible in the current frame
+        /////////////////////////////////////////////////
+        bool reserveCache() const;
+
+        /////////////////////////////////////////////////
+        /// \brief Free the cached drawing of a chunk
+        ///
+        /// \param chunk Chunk to release
+        /////////////////////////////////////////////////
+        static void release(Chunk& chunk);
+
+        /////////////////////////////////////////////////
+        /// \brief Draw the tiles of a chunk into its texture
+        ///
+        /// \param renderer Renderer that will handle the drawing
+        /// \param chunk    Index of the chunk
+        /////////////////////////////////////////////////
+        void bake(SDL_Renderer* renderer, size_t chunk) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Draw the quads of the scratch vertices at the position of their chunk
+        ///
+        /// \param renderer Renderer that will handle the drawing
+        /// \param offset   Position of the chunk
+        /////////////////////////////////////////////////
+        void drawGeometry(SDL_Renderer* renderer, const SDL_FPoint& offset) const;
+
+        const Texture* m_tileset;                  ///< Texture containing the tiles
+        Sizei m_tileSize;                          ///< Size of the tiles, in pixels
+        Sizei m_mapSize;                           ///< Size of the map, in cells
+        Sizei m_chunkSize;                         ///< Size of the chunks, in cells
+        Sizei m_chunksCount;                       ///< Number of chunks on each axis
+        uint16_t m_tilesCount;                     ///< Number of tiles in the tileset
+        int m_tilesetColumns;                      ///< Number of tiles on a row of the tileset
+        Positionf m_position;                      ///< Position of the map
+        std::vector<uint16_t> m_tiles;             ///< Tile of each cell, row by row
+        std::vector<int> m_indices;                ///< Triangles drawing the quads of a full chunk
+        size_t m_cacheSize;                        ///< Maximum number of cached chunks
+        mutable std::vector<Chunk> m_chunks;       ///< Chunks, row by row
+        mutable std::vector<size_t> m_cached;      ///< Indices of the cached chunks
+        mutable std::vector<SDL_Vertex> m_scratch; ///< Vertices of the chunk being baked or drawn
+        mutable uint64_t m_frame;                  ///< Number of drawn frames
+};
+
+}
+
+#endif // IKSDL_TILE_MAP_HPP
@@ -0,0 +1,101 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_USER_EVENT_HPP
+#define IKSDL_USER_EVENT_HPP
+
+#include "iksdl/AbstractEvent.hpp"
+#include "iksdl/EventHandler.hpp"
+#include "iksdl/UserEventQueue.hpp"
+#include <any>
+#include <typeinfo>
+#include <utility>
+
+namespace iksdl
+{
+
+/////////////////////////////////////////////////
+/// \brief Represents an event posted by the application, possibly from another thread
+///
+/// Any copyable value can be posted as the payload of an event.
+/// Posting wakes up a window waiting in \a Window::waitEvent.
+/// The payload is moved to the event, it is never copied
+/// through SDL.
+///
+/// When several windows are opened, user events are given to
+/// the first opened window. The events posted before any
+/// window is opened are kept until the first one is.
+/////////////////////////////////////////////////
+class UserEvent final : public AbstractEvent
+{
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Constructor
+        ///
+        /// \param payload Payload of the event
+        /////////////////////////////////////////////////
+        inline explicit UserEvent(std::any&& payload) : m_payload(std::move(payload)) {}
+
+        /////////////////////////////////////////////////
+        /// \brief Post an event, from any thread
+        ///
+        /// This method may throw \a SdlException if the event
+        /// loop could not be woken up.
+        ///
+        /// \param payload Payload of the event
+        /////////////////////////////////////////////////
+        template<typename T>
+        static void post(T&& payload) { priv::UserEventQueue::getInstance()->post(std::any(std::forward<T>(payload))); }
+
+        /////////////////////////////////////////////////
+        /// \brief Make the given handler execute the action related to the user event
+        ///
+        /// \param handler Event handler that will be asked to consume the user event
+        /////////////////////////////////////////////////
+        inline virtual void play(EventHandler& handler) const { handler.handleUserEvent(*this); }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the payload if it has the given type
+        ///
+        /// \tparam T Type of the posted payload
+        ///
+        /// \return Pointer to the payload, or null if the payload has another type
+        /////////////////////////////////////////////////
+        template<typename T>
+        inline const T* getPayload() const { return std::any_cast<T>(&m_payload); }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the type of the payload
+        ///
+        /// \return Type of the posted payload
+        /////////////////////////////////////////////////
+        inline const std::type_info& getPayloadType() const { return m_payload.type(); }
+
+    private:
+
+        std::any m_payload; ///< Payload of the event
+};
+
+}
+
+#endif // IKSDL_USER_EVENT_HPP
@@ -0,0 +1,143 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_USER_EVENT_QUEUE_HPP
+#define IKSDL_USER_EVENT_QUEUE_HPP
+
+#include "iksdl/iksdl_export.hpp"
+#include <any>
+#include <atomic>
+#include <cstdint>
+
+namespace iksdl::priv
+{
+
+/////////////////////////////////////////////////
+/// \brief Lock-free queue of the user events posted from any thread
+///
+/// Any number of threads can post events, only the thread that
+/// handles the window events takes them. When the queue receives
+/// events, a single SDL event of a registered type is pushed to
+/// wake up the event loop. The payloads themselves never go
+/// through SDL.
+///
+/// \warning This is IKSDL internal code that should not be
+/// used outside of the library
+/////////////////////////////////////////////////
+class UserEventQueue
+{
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Element of the queue
+        /////////////////////////////////////////////////
+        struct Node
+        {
+            std::atomic<Node*> next; ///< Next element, towards the newest one
+            std::any payload;        ///< Posted payload
+        };
+
+        /////////////////////////////////////////////////
+        /// \brief Get the singleton instance
+        ///
+        /// \return Singleton instance
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static UserEventQueue* getInstance();
+
+        /////////////////////////////////////////////////
+        /// \brief Destructor, destroying the events that were not taken
+        /////////////////////////////////////////////////
+        ~UserEventQueue();
+
+        UserEventQueue(const UserEventQueue&) = delete;
+        UserEventQueue& operator=(const UserEventQueue&) = delete;
+
+        /////////////////////////////////////////////////
+        /// \brief Post an event, from any thread
+        ///
+        /// This method may throw \a SdlException if the event
+        /// loop could not be woken up.
+        ///
+        /// \param payload Payload of the event
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void post(std::any&& payload);
+
+        /////////////////////////////////////////////////
+        /// \brief Take the oldest posted event
+        ///
+        /// This must only be called from the thread that handles
+        /// the window events. Ownership of the returned element
+        /// goes to the caller.
+        ///
+        /// \return Oldest element, or null if there is none
+        /////////////////////////////////////////////////
+        Node* take();
+
+        /////////////////////////////////////////////////
+        /// \brief Acknowledge the wake up event
+        ///
+        /// The next post will push a new wake up event. This must
+        /// be called before taking the events, so that none is
+        /// missed.
+        /////////////////////////////////////////////////
+        inline void acknowledgeWakeUp() { m_wakeUpPending.store(false, std::memory_order_seq_cst); }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the SDL event type used to wake up the event loop
+        ///
+        /// \return Registered SDL event type
+        /////////////////////////////////////////////////
+        inline uint32_t getWakeUpType() const { return m_wakeUpType; }
+
+        /////////////////////////////////////////////////
+        /// \brief Extract the payload of an element and destroy it
+        ///
+        /// \param node Element taken from the queue
+        ///
+        /// \return Payload of the element
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static std::any release(Node* node);
+
+    private:
+
+        /////////////////////////////////////////////////
+        /// \brief Default constructor
+        /////////////////////////////////////////////////
+        UserEventQueue();
+
+        /////////////////////////////////////////////////
+        /// \brief Link an element at the end of the queue
+        ///
+        /// \param node Element to link
+        /////////////////////////////////////////////////
+        void push(Node* node);
+
+        std::atomic<Node*> m_head;         ///< Newest element, where the producers link
+        Node* m_tail;                      ///< Oldest element, where the consumer takes
+        Node m_stub;                       ///< Element keeping the queue linked when it is empty
+        std::atomic<bool> m_wakeUpPending; ///< Has a wake up event been pushed and not handled yet?
+        uint32_t m_wakeUpType;             ///< Registered SDL event type used to wake up the event loop
+};
+
+}
+
+#endif // IKSDL_USER_EVENT_QUEUE_HPP
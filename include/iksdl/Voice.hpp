@@ -0,0 +1,144 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_VOICE_HPP
+#define IKSDL_VOICE_HPP
+
+#include "iksdl/iksdl_export.hpp"
+#include <cstdint>
+
+namespace iksdl
+{
+
+/////////////////////////////////////////////////
+/// \brief Handle to one play of a sound
+///
+/// A voice is returned each time a sound is played. It controls
+/// only the audio channel of this play, so several plays of the
+/// same sound can be paused, stopped or have their volume
+/// changed independently.
+///
+/// Voices are cheap to copy. Once the play has finished or has
+/// been stopped, the voice becomes invalid and all the methods
+/// do nothing, even if its audio channel is used by another play.
+///
+/// \see Sound, SoundBank
+/////////////////////////////////////////////////
+class Voice
+{
+    friend class Sound;
+
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Default constructor, creates an invalid voice
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT constexpr Voice() : m_channel(-1), m_serial(0) {}
+
+        /////////////////////////////////////////////////
+        /// \brief Pause the voice
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void pause() const;
+
+        /////////////////////////////////////////////////
+        /// \brief Resume the voice
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void resume() const;
+
+        /////////////////////////////////////////////////
+        /// \brief Stop the voice
+        ///
+        /// The voice becomes invalid.
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void stop() const;
+
+        /////////////////////////////////////////////////
+        /// \brief Change the volume of the voice
+        ///
+        /// This volume is combined with the volume of the sound.
+        ///
+        /// \param volume New volume, between 0 and 128
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void setVolume(int volume) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Get the volume of the voice
+        ///
+        /// \return Volume between 0 and 128, or 0 if the voice is invalid
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT int getVolume() const;
+
+        /////////////////////////////////////////////////
+        /// \brief Change the volume of each side of the voice
+        ///
+        /// Both sides are at full volume by default.
+        ///
+        /// \param left  Volume of the left side, between 0 and 255
+        /// \param right Volume of the right side, between 0 and 255
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void setPanning(uint8_t left, uint8_t right) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Is the voice still valid?
+        ///
+        /// \return True if the voice has neither finished nor been stopped
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT bool isValid() const;
+
+        /////////////////////////////////////////////////
+        /// \brief Is the voice currently being played?
+        ///
+        /// \return True if the voice is valid and not paused
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT bool isPlaying() const;
+
+        /////////////////////////////////////////////////
+        /// \brief Is the voice currently paused?
+        ///
+        /// \return True if the voice is valid and paused
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT bool isPaused() const;
+
+        /////////////////////////////////////////////////
+        /// \brief Is the voice still valid?
+        ///
+        /// \return True if the voice has neither finished nor been stopped
+        /////////////////////////////////////////////////
+        inline explicit operator bool() const { return isValid(); }
+
+    private:
+
+        /////////////////////////////////////////////////
+        /// \brief Constructor of a started voice
+        ///
+        /// \param channel Audio channel of the voice
+        /// \param serial  Serial number of the voice
+        /////////////////////////////////////////////////
+        constexpr Voice(int channel, uint64_t serial) : m_channel(channel), m_serial(serial) {}
+
+        int m_channel;     ///< Audio channel of the voice, -1 if the voice was never started
+        uint64_t m_serial; ///< Serial number of the voice, distinguishes the plays on the same channel
+};
+
+}
+
+#endif // IKSDL_VOICE_HPP
@@ -0,0 +1,98 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_VOICE_MANAGER_HPP
+#define IKSDL_VOICE_MANAGER_HPP
+
+#include "iksdl/iksdl_export.hpp"
+#include <cstddef>
+
+namespace iksdl
+{
+
+/////////////////////////////////////////////////
+/// \brief Allows to limit the number of sounds played simultaneously
+///
+/// Each playing sound uses a voice, mixed by the audio thread.
+/// Limiting the number of voices bounds the work of the audio
+/// thread. When a limit is reached, a voice may be stolen to
+/// play the new sound, according to the steal policy.
+///
+/// \see SoundPolicy
+/////////////////////////////////////////////////
+class VoiceManager
+{
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Choice of the voice to stop when a limit is reached
+        /////////////////////////////////////////////////
+        enum class StealPolicy
+        {
+            None,          ///< Never stop a voice, the new sound is not played
+            Oldest,        ///< Stop the voice that started first
+            Quietest,      ///< Stop the voice with the lowest volume
+            LowestPriority ///< Stop the voice with the lowest priority, then the oldest one
+        };
+
+        /////////////////////////////////////////////////
+        /// \brief Limit the total number of voices
+        ///
+        /// \param voices Maximum number of simultaneous voices, or 0 for no limit
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static void setMaxVoices(unsigned int voices);
+
+        /////////////////////////////////////////////////
+        /// \brief Get the limit of the total number of voices
+        ///
+        /// \return Maximum number of simultaneous voices, or 0 for no limit
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static unsigned int getMaxVoices();
+
+        /////////////////////////////////////////////////
+        /// \brief Choose how a voice is stolen when a limit is reached
+        ///
+        /// In any case, a voice is never stolen by a sound with
+        /// a lower priority.
+        ///
+        /// \param policy Steal policy, \a StealPolicy::Oldest by default
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static void setStealPolicy(StealPolicy policy);
+
+        /////////////////////////////////////////////////
+        /// \brief Get how a voice is stolen when a limit is reached
+        ///
+        /// \return Steal policy
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static StealPolicy getStealPolicy();
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of voices currently playing
+        ///
+        /// \return Number of voices
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT static size_t getActiveVoicesCount();
+};
+
+}
+
+#endif // IKSDL_VOICE_MANAGER_HPP
@@ -0,0 +1,333 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_VOICES_HPP
+#define IKSDL_VOICES_HPP
+
+#include "iksdl/SoundPolicy.hpp"
+#include "iksdl/VoiceManager.hpp"
+#include <SDL_mixer.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace iksdl::priv
+{
+
+/////////////////////////////////////////////////
+/// \brief Voices that are played from the same sound
+///
+/// \warning This is IKSDL internal code that should not be used outside of the library
+/////////////////////////////////////////////////
+struct VoiceGroup
+{
+    uint64_t id;                                     ///< Unique ID of the group, 0 if it has no voice
+    SoundPolicy policy;                              ///< Limits applied to the voices of the group
+    std::chrono::steady_clock::time_point lastStart; ///< Time when the last voice of the group started
+    bool started;                                    ///< Has a voice of the group ever started?
+};
+
+/////////////////////////////////////////////////
+/// \brief Keeps track of the voices being played and applies the limits of voices
+///
+/// This class must only be used from the main thread, the
+/// audio thread only frees the channels when they finish.
+///
+/// The voices are played by SDL_mixer, or by the mixing engine
+/// when it is installed. The mixing engine's channels come after
+/// SDL_mixer's ones.
+///
+/// \warning This is IKSDL internal code that should not be used outside of the library
+/////////////////////////////////////////////////
+class Voices
+{
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Get the singleton instance
+        ///
+        /// \return Singleton instance
+        /////////////////////////////////////////////////
+        inline static Voices* getInstance() { static Voices voices; return &voices; }
+
+        /////////////////////////////////////////////////
+        /// \brief Create a new group of voices
+        ///
+        /// This method can be called from any thread.
+        ///
+        /// \param policy Limits applied to the voices of the group
+        ///
+        /// \return Group of voices with a unique ID
+        /////////////////////////////////////////////////
+        VoiceGroup createGroup(const SoundPolicy& policy);
+
+        /////////////////////////////////////////////////
+        /// \brief Start a new voice of a group
+        ///
+        /// Applies the retrigger window, then the limits of the group
+        /// and the global limit, stealing voices if needed.
+        ///
+        /// \param group Group of the voice
+        /// \param chunk Sound to play
+        /// \param loops Number of times to play the sound
+        /// \param ticks Maximum time to play the sound in milliseconds, -1 for no limit
+        ///
+        /// \return Audio channel of the voice, or -1 if the voice was not started
+        /////////////////////////////////////////////////
+        int start(VoiceGroup& group, Mix_Chunk* chunk, int loops, int ticks);
+
+        /////////////////////////////////////////////////
+        /// \brief Stop a voice
+        ///
+        /// Nothing happens if the voice is not playing anymore.
+        ///
+        /// \param channel Audio channel of the voice
+        /// \param serial  Serial number of the voice
+        /////////////////////////////////////////////////
+        void stopVoice(int channel, uint64_t serial);
+
+        /////////////////////////////////////////////////
+        /// \brief Stop all the voices of a group
+        ///
+        /// \param group Group of the voices to stop
+        /////////////////////////////////////////////////
+        void stopGroup(const VoiceGroup& group);
+
+        /////////////////////////////////////////////////
+        /// \brief Get the serial number of the voice playing on a channel
+        ///
+        /// Each started voice gets a unique serial number, which allows
+        /// to know if a channel still plays the same voice.
+        ///
+        /// \param channel Audio channel of the voice
+        ///
+        /// \return Serial number of the voice
+        /////////////////////////////////////////////////
+        inline uint64_t getSerial(int channel) const { return m_voices[channel].serial; }
+
+        /////////////////////////////////////////////////
+        /// \brief Is a voice still playing on its channel?
+        ///
+        /// \param channel Audio channel of the voice
+        /// \param serial  Serial number of the voice
+        ///
+        /// \return True if the voice has neither finished nor been stopped
+        /////////////////////////////////////////////////
+        bool isCurrent(int channel, uint64_t serial) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Pause a voice
+        ///
+        /// The voice is expected to be current, like all the
+        /// methods controlling a voice by its channel.
+        ///
+        /// \param channel Audio channel of the voice
+        /////////////////////////////////////////////////
+        void pause(int channel);
+
+        /////////////////////////////////////////////////
+        /// \brief Resume a paused voice
+        ///
+        /// \param channel Audio channel of the voice
+        /////////////////////////////////////////////////
+        void resume(int channel);
+
+        /////////////////////////////////////////////////
+        /// \brief Is a voice paused?
+        ///
+        /// \param channel Audio channel of the voice
+        ///
+        /// \return True if the voice is paused
+        /////////////////////////////////////////////////
+        bool isPaused(int channel) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Set the volume of a voice
+        ///
+        /// It is combined with the volume of the sound played by the voice.
+        ///
+        /// \param channel Audio channel of the voice
+        /// \param volume  New volume of the voice, between 0 and 128
+        /////////////////////////////////////////////////
+        void setVolume(int channel, int volume);
+
+        /////////////////////////////////////////////////
+        /// \brief Get the volume of a voice
+        ///
+        /// \param channel Audio channel of the voice
+        ///
+        /// \return Volume of the voice, between 0 and 128
+        /////////////////////////////////////////////////
+        int getVolume(int channel) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Set the volume of each side of a stereo voice
+        ///
+        /// \param channel Audio channel of the voice
+        /// \param left    Volume of the left side, between 0 and 255
+        /// \param right   Volume of the right side, between 0 and 255
+        /////////////////////////////////////////////////
+        void setPanning(int channel, uint8_t left, uint8_t right);
+
+        /////////////////////////////////////////////////
+        /// \brief Apply a new volume of a sound to the voices playing it
+        ///
+        /// SDL_mixer reads the volume of the sound while mixing,
+        /// only the voices of the mixing engine need it.
+        ///
+        /// \param group  Group of the voices of the sound
+        /// \param volume New volume of the sound, between 0 and 128
+        /////////////////////////////////////////////////
+        void setChunkVolume(const VoiceGroup& group, int volume);
+
+        /////////////////////////////////////////////////
+        /// \brief Pause all the voices
+        /////////////////////////////////////////////////
+        void pauseAll();
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of voices currently playing
+        ///
+        /// \return Number of voices
+        /////////////////////////////////////////////////
+        size_t getActiveCount();
+
+        /////////////////////////////////////////////////
+        /// \brief Limit the number of voices playing simultaneously
+        ///
+        /// The limit applies to the next started voices, the
+        /// voices already playing are not stopped.
+        ///
+        /// \param voices Maximum number of voices, 0 for no limit
+        /////////////////////////////////////////////////
+        inline void setMaxVoices(unsigned int voices) { m_maxVoices = voices; }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the maximum number of voices playing simultaneously
+        ///
+        /// \return Maximum number of voices, 0 for no limit
+        /////////////////////////////////////////////////
+        inline unsigned int getMaxVoices() const { return m_maxVoices; }
+
+        /////////////////////////////////////////////////
+        /// \brief Set how the voice to steal is chosen when a limit is reached
+        ///
+        /// \param policy Choice of the voice to steal
+        /////////////////////////////////////////////////
+        inline void setStealPolicy(VoiceManager::StealPolicy policy) { m_stealPolicy = policy; }
+
+        /////////////////////////////////////////////////
+        /// \brief Get how the voice to steal is chosen when a limit is reached
+        ///
+        /// \return Choice of the voice to steal
+        /////////////////////////////////////////////////
+        inline VoiceManager::StealPolicy getStealPolicy() const { return m_stealPolicy; }
+
+    private:
+
+        /////////////////////////////////////////////////
+        /// \brief Voice played on an audio channel
+        /////////////////////////////////////////////////
+        struct Voice
+        {
+            uint64_t serial;                             ///< Unique serial number of the voice
+            uint64_t group;                              ///< ID of the group of the voice
+            int priority;                                ///< Priority of the voice
+            std::chrono::steady_clock::time_point start; ///< Time when the voice started
+            Mix_Chunk* chunk;                            ///< Sound played by the voice
+            bool active;                                 ///< Is the voice still playing?
+        };
+
+        /////////////////////////////////////////////////
+        /// \brief Default constructor
+        /////////////////////////////////////////////////
+        Voices();
+
+        /////////////////////////////////////////////////
+        /// \brief Play a sound with SDL_mixer or with the mixing engine if it is installed
+        ///
+        /// \param chunk Sound to play
+        /// \param loops Number of times to play the sound
+        /// \param ticks Maximum time to play the sound in milliseconds, -1 for no limit
+        ///
+        /// \return Audio channel of the voice, or -1 if the sound could not be played
+        /////////////////////////////////////////////////
+        int play(Mix_Chunk* chunk, int loops, int ticks);
+
+        /////////////////////////////////////////////////
+        /// \brief Is a channel still used by the voice that was started on it?
+        ///
+        /// \param channel Audio channel of the voice
+        ///
+        /// \return True if the voice has not finished yet
+        /////////////////////////////////////////////////
+        bool isAlive(int channel) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Forget the voices whose channel was freed by the audio thread
+        /////////////////////////////////////////////////
+        void prune();
+
+        /////////////////////////////////////////////////
+        /// \brief Steal voices until a new voice can be started
+        ///
+        /// Both the limit of the group and the global limit are
+        /// applied. No voice is stopped if they cannot both be
+        /// satisfied.
+        ///
+        /// \param group    Group of the new voice
+        /// \param priority Priority of the new voice
+        ///
+        /// \return True if the new voice can be started
+        /////////////////////////////////////////////////
+        bool makeRoom(const VoiceGroup& group, int priority);
+
+        /////////////////////////////////////////////////
+        /// \brief Choose the voice to steal
+        ///
+        /// \param group    ID of the group to choose from, or 0 to choose from all the voices
+        /// \param priority Priority of the new voice
+        /// \param excluded Audio channels of the voices already chosen
+        ///
+        /// \return Audio channel of the voice to steal, or -1 if no voice can be stolen
+        /////////////////////////////////////////////////
+        int chooseVictim(uint64_t group, int priority, const std::vector<int>& excluded) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Stop a voice and forget it
+        ///
+        /// \param channel Audio channel of the voice
+        /////////////////////////////////////////////////
+        void stop(int channel);
+
+        std::vector<Voice> m_voices;             ///< Voices indexed by audio channel
+        std::vector<int> m_active;               ///< Audio channels of the active voices
+        unsigned int m_maxVoices;                ///< Maximum number of simultaneous voices, 0 for no limit
+        VoiceManager::StealPolicy m_stealPolicy; ///< Choice of the voice to steal when a limit is reached
+        std::atomic<uint64_t> m_nextGroupId;     ///< ID of the next created group
+        uint64_t m_nextSerial;                   ///< Serial number of the next started voice
+};
+
+}
+
+#endif // IKSDL_VOICES_HPP
@@ -28,6 +28,12 @@
 #include "iksdl/Color.hpp"
 #include "iksdl/Event.hpp"
 #include "iksdl/EventSupport.hpp"
+#include "iksdl/EventCoalescing.hpp"
+#include "iksdl/EventBuilder.hpp"
+#include "iksdl/EventDispatch.hpp"
+#include "iksdl/EventHandler.hpp"
+#include "iksdl/EventRouter.hpp"
+#include "iksdl/GameLoop.hpp"
 #include "iksdl/QuitEvent.hpp"
 #include "iksdl/WindowEvent.hpp"
 #include "iksdl/KeyboardEvent.hpp"
@@ -41,9 +47,9 @@
 #include "iksdl/WindowOptions.hpp"
 #include "iksdl/iksdl_export.hpp"
 #include <SDL.h>
-#include <SDL_image.h>
 #include <string>
 #include <memory>
+#include <utility>
 
 namespace iksdl
 {
@@ -109,6 +115,16 @@ class Window : public Renderer
         /// This method always return immediately, it never
         /// waits, event if there is not pending event.
         ///
+        /// Only the events of this window and the events that
+        /// concern all the windows, such as the quit event, are
+        /// returned. The events of the other windows are kept
+        /// for them. The events without a window, such as the
+        /// joystick events, go to the window with the keyboard focus.
+        ///
+        /// The pending events are never dropped, so every opened
+        /// window should be polled regularly, otherwise its events
+        /// accumulate in memory.
+        ///
         /// \tparam E Type of events to fetch
         ///
         /// \return Event ready to be handled
@@ -118,10 +134,14 @@ class Window : public Renderer
         {
             SDL_Event event;
 
-            if(SDL_PollEvent(&event) && event.window.windowID == m_windowId)
-                return buildEvent<E>(event);
+            while(priv::EventRouter::getInstance()->poll(m_windowId, event))
+            {
+                Event builtEvent = priv::buildEvent<E>(event);
+                if(builtEvent)
+                    return builtEvent;
+            }
 
-            return Event(nullptr);
+            return Event();
         }
 
         /////////////////////////////////////////////////
@@ -142,13 +162,80 @@ class Window : public Renderer
         {
             SDL_Event event;
 
-            if(SDL_WaitEvent(&event) && event.window.windowID == m_windowId)
-                return buildEvent<E>(event);
+            while(priv::EventRouter::getInstance()->wait(m_windowId, event))
+            {
+                Event builtEvent = priv::buildEvent<E>(event);
+                if(builtEvent)
+                    return builtEvent;
+            }
+
+            throw SdlException(std::string(WAIT_EVENT_ERROR) + SDL_GetError());
+        }
+
+        /////////////////////////////////////////////////
+        /// \brief Give all the pending events to a handler
+        ///
+        /// The handler only needs to provide the \c handleXxxEvent
+        /// methods for the events it cares about. The other types
+        /// of events are not built at all, and the methods are
+        /// called without any virtual call.
+        ///
+        /// \param handler Event handler that will be asked to consume the events
+        ///
+        /// \see StaticEventHandler
+        /////////////////////////////////////////////////
+        template<StaticEventHandler Handler>
+        void dispatchEvents(Handler& handler) const
+        {
+            while(const Event event = pollEvent<HANDLED_EVENTS<Handler>>())
+                dispatchEvent(handler, event);
+        }
 
-            if(event.window.windowID == m_windowId)
-                throw SdlException(std::string(WAIT_EVENT_ERROR) + SDL_GetError());
+        /////////////////////////////////////////////////
+        /// \brief Run a fixed-timestep game loop on this window
+        ///
+        /// Each frame, the pending events of this window are given
+        /// to the handler, the simulation is updated as many times
+        /// as needed, then the window is cleared, rendered and displayed.
+        ///
+        /// The loop runs until \a GameLoop::stop is called, typically
+        /// by the event handler when it receives a quit event.
+        ///
+        /// \tparam E Type of events to handle
+        ///
+        /// \param loop    Game loop that paces the frames
+        /// \param handler Event handler receiving the events
+        /// \param update  Called for each simulation step, with the time step as \a std::chrono::nanoseconds
+        /// \param render  Called once per frame between clearing and displaying, with the interpolation factor as \c double
+        /////////////////////////////////////////////////
+        template<EventSupport E = ALL_EVENTS_SUPPORT, typename Update, typename Render>
+        void run(GameLoop& loop, EventHandler& handler, Update&& update, Render&& render)
+        {
+            loop.run([this, &handler]()
+                     {
+                         while(const Event event = pollEvent<E>())
+                             event.play(handler);
+                     },
+                     std::forward<Update>(update),
+                     [this, &render](double interpolation)
+                     {
+                         clear();
+                         render(interpolation);
+                         display();
+                     });
         }
 
+        /////////////////////////////////////////////////
+        /// \brief Choose which events of this window are merged when they follow each other
+        ///
+        /// Coalescing reduces the number of events to handle when
+        /// a device sends many of them, such as a gaming mouse. It
+        /// applies to the events received after this call.
+        ///
+        /// \param coalescing Types of events to merge
+        /////////////////////////////////////////////////
+        IKSDL_EXPORT void setEventCoalescing(const EventCoalescing& coalescing);
+
         /////////////////////////////////////////////////
         /// \brief Get window position
         ///
@@ -165,17 +252,10 @@ class Window : public Renderer
 
     private:
 
-        static constexpr std::string_view CREATE_CONTEXT_ERROR = "Could not create SDL context.\nCause: ";
-        static constexpr std::string_view CREATE_IMAGE_LOADERS_ERROR = "Could not load image loaders.\nCause: ";
-        static constexpr std::string_view CREATE_FONT_LOADERS_ERROR = "Could not load font loaders.\nCause: ";
-        static constexpr std::string_view CREATE_AUDIO_LOADERS_ERROR = "Could not load audio loaders.\nCause: ";
         static constexpr std::string_view CREATE_WINDOW_ERROR = "Could not create window.\nCause: ";
         static constexpr std::string_view WAIT_EVENT_ERROR = "Error while waiting for an event.\nCause: ";
 
         static constexpr Positioni UNDEFINED_POSITION = Positioni(SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED);
-        static constexpr int IMG_LIBRARIES = IMG_INIT_PNG | IMG_INIT_JPG | IMG_INIT_TIF | IMG_INIT_WEBP;
-        static constexpr int AUDIO_FREQUENCY = 44100;
-        static constexpr int AUDIO_CHUNK_SIZE = 2048;
 
         /////////////////////////////////////////////////
         /// \brief Constructor from a SDL window
@@ -198,68 +278,6 @@ class Window : public Renderer
         static SDL_Window* createWindow(const std::string& title, const Sizei& size,
                                         const WindowOptions& options, const Positioni& position);
 
-        /////////////////////////////////////////////////
-        /// \brief Build a \a iksdl::event from a SDL event
-        ///
-        /// \tparam E Event types to handle, other types are ignored
-        ///
-        /// \param sdlEvent SDL event to transform
-        ///
-        /// \return Transformed event
-        /////////////////////////////////////////////////
-        template<EventSupport E>
-        Event buildEvent(const SDL_Event sdlEvent) const
-        {
-            try
-            {
-                if constexpr(E.mouseMotionEventsEnabled)
-                {
-                    if(sdlEvent.type == SDL_MOUSEMOTION)
-                        return Event(std::make_unique<MouseMotionEvent>(MouseMotionEvent(sdlEvent.motion)));
-                }
-
-                if constexpr(E.mouseButtonEventsEnabled)
-                {
-                    if(sdlEvent.type == SDL_MOUSEBUTTONDOWN || sdlEvent.type == SDL_MOUSEBUTTONUP)
-                        return Event(std::make_unique<MouseButtonEvent>(MouseButtonEvent(sdlEvent.button)));
-                }
-
-                if constexpr(E.keyboardEventsEnabled)
-                {
-                    if(sdlEvent.type == SDL_KEYDOWN || sdlEvent.type == SDL_KEYUP)
-                        return Event(std::make_unique<KeyboardEvent>(KeyboardEvent(sdlEvent.key)));
-                }
-
-                if constexpr(E.mouseWheelEventsEnabled)
-                {
-                    if(sdlEvent.type == SDL_MOUSEWHEEL)
-                        return Event(std::make_unique<MouseWheelEvent>(MouseWheelEvent(sdlEvent.wheel)));
-                }
-
-                if constexpr(E.windowEventsEnabled)
-                {
-                    if(sdlEvent.type == SDL_WINDOWEVENT)
-                        return Event(std::make_unique<WindowEvent>(WindowEvent(sdlEvent.window)));
-                }
-
-                if(sdlEvent.type == SDL_QUIT)
-                    return Event(std::make_unique<QuitEvent>());
-
-                return Event(nullptr);
-            }
-            catch(const SdlException&)
-            {
-                return Event(nullptr);
-            }
-        }
-
-        /////////////////////////////////////////////////
-        /// \brief Get number of opened windows
-        ///
-        /// \return Number of windows
-        /////////////////////////////////////////////////
-        inline static unsigned int& windowsCount() { static unsigned int count = 0; return count; }
-
         SDL_Window* m_window; ///< SDL window
         uint32_t m_windowId;  ///< Window identifier
 };
@@ -42,7 +42,7 @@ namespace iksdl
 /////////////////////////////////////////////////
 /// \brief Represents an event related to a window
 /////////////////////////////////////////////////
-class WindowEvent : public AbstractEvent
+class WindowEvent final : public AbstractEvent
 {
     public:
 
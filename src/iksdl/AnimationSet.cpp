@@ -0,0 +1,193 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/AnimationSet.hpp"
+#include "iksdl/InvalidParameterException.hpp"
+#include "iksdl/Texture.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <string>
+
+namespace iksdl
+{
+AnimationSet::AnimationSet(const SpriteSheet& sheet) :
+    m_sheet(&sheet)
+{}
+
+size_t AnimationSet::add(size_t animation, const Positionf& position, const Sizef& scale)
+{
+    checkAnimation(animation);
+
+    SDL_Vertex vertex {};
+    vertex.color = { .r = 255, .g = 255, .b = 255, .a = 255 };
+
+    const size_t index = m_animations.size();
+    const int base = static_cast<int>(index * VERTICES_PER_INSTANCE);
+
+    m_animations.push_back(static_cast<uint32_t>(animation));
+    m_steps.push_back(m_sheet->m_animations[animation].first);
+    m_times.push_back(0);
+    m_positions.push_back({ .x = position.getX(), .y = position.getY() });
+    m_scales.push_back({ .x = scale.getWidth(), .y = scale.getHeight() });
+    m_vertices.resize(m_vertices.size() + VERTICES_PER_INSTANCE, vertex);
+    m_indices.insert(m_indices.end(), { base, base + 1, base + 2, base, base + 2, base + 3 });
+
+    writeFrame(index, m_sheet->m_steps[m_steps[index]].frame);
+    return index;
+}
+
+void AnimationSet::remove(size_t index)
+{
+    checkInstance(index);
+
+    // Move the last instance to the removed one, so the arrays stay contiguous
+    const size_t last = m_animations.size() - 1;
+    if(index != last)
+    {
+        m_animations[index] = m_animations[last];
+        m_steps[index] = m_steps[last];
+        m_times[index] = m_times[last];
+        m_positions[index] = m_positions[last];
+        m_scales[index] = m_scales[last];
+        std::copy_n(m_vertices.begin() + static_cast<std::ptrdiff_t>(last * VERTICES_PER_INSTANCE), VERTICES_PER_INSTANCE,
+                    m_vertices.begin() + static_cast<std::ptrdiff_t>(index * VERTICES_PER_INSTANCE));
+    }
+
+    m_animations.pop_back();
+    m_steps.pop_back();
+    m_times.pop_back();
+    m_positions.pop_back();
+    m_scales.pop_back();
+    m_vertices.resize(last * VERTICES_PER_INSTANCE);
+    m_indices.resize(last * INDICES_PER_INSTANCE);
+}
+
+void AnimationSet::clear()
+{
+    m_animations.clear();
+    m_steps.clear();
+    m_times.clear();
+    m_positions.clear();
+    m_scales.clear();
+    m_vertices.clear();
+    m_indices.clear();
+}
+
+void AnimationSet::play(size_t index, size_t animation)
+{
+    checkInstance(index);
+    checkAnimation(animation);
+
+    m_animations[index] = static_cast<uint32_t>(animation);
+    m_steps[index] = m_sheet->m_animations[animation].first;
+    m_times[index] = 0;
+    writeFrame(index, m_sheet->m_steps[m_steps[index]].frame);
+}
+
+void AnimationSet::update(std::chrono::nanoseconds elapsed)
+{
+    const int64_t delta = elapsed.count();
+    const SpriteSheet::Animation* const animations = m_sheet->m_animations.data();
+    const SpriteSheet::Step* const steps = m_sheet->m_steps.data();
+    const size_t count = m_animations.size();
+
+    for(size_t i = 0 ; i < count ; ++i)
+    {
+        const SpriteSheet::Animation& animation = animations[m_animations[i]];
+
+        int64_t time = m_times[i] + delta;
+        if(time >= animation.duration)
+            time = animation.loop ? time % animation.duration : animation.duration;
+        m_times[i] = time;
+
+        // Most updates stay on the current step, and a loop goes back to the first one
+        uint32_t step = m_steps[i];
+        if(step != animation.first && time < steps[step - 1].end)
+            step = animation.first;
+
+        const uint32_t last = animation.first + animation.count - 1;
+        while(step < last && time >= steps[step].end)
+            step++;
+
+        // Only the instances that change frame touch their vertices
+        if(step != m_steps[i])
+        {
+            m_steps[i] = step;
+            writeFrame(i, steps[step].frame);
+        }
+    }
+}
+
+void AnimationSet::draw(SDL_Renderer* const renderer) const
+{
+    if(m_indices.empty())
+        return;
+
+    SDL_RenderGeometry(renderer, m_sheet->m_texture->m_texture, m_vertices.data(), static_cast<int>(m_vertices.size()),
+                       m_indices.data(), static_cast<int>(m_indices.size()));
+}
+
+void AnimationSet::setPosition(size_t index, const Positionf& position)
+{
+    checkInstance(index);
+
+    m_positions[index] = { .x = position.getX(), .y = position.getY() };
+    writeFrame(index, m_sheet->m_steps[m_steps[index]].frame);
+}
+
+bool AnimationSet::isFinished(size_t index) const
+{
+    const SpriteSheet::Animation& animation = m_sheet->m_animations[m_animations[index]];
+    return !animation.loop && m_times[index] >= animation.duration;
+}
+
+void AnimationSet::checkAnimation(size_t animation) const
+{
+    if(animation >= m_sheet->m_animations.size())
+        throw InvalidParameterException("Animation set sprite sheet has no animation " + std::to_string(animation));
+}
+
+void AnimationSet::checkInstance(size_t index) const
+{
+    if(index >= m_animations.size())
+        throw InvalidParameterException("Animation set has no instance " + std::to_string(index));
+}
+
+void AnimationSet::writeFrame(size_t index, uint32_t frame)
+{
+    const SpriteSheet::Frame& source = m_sheet->m_frames[frame];
+    const SDL_FPoint& position = m_positions[index];
+    const float width = static_cast<float>(source.rect.w) * m_scales[index].x;
+    const float height = static_cast<float>(source.rect.h) * m_scales[index].y;
+
+    // Corners in clockwise order from the top-left one, matching the indices
+    SDL_Vertex* const vertices = m_vertices.data() + index * VERTICES_PER_INSTANCE;
+    vertices[0].position = { .x = position.x, .y = position.y };
+    vertices[0].tex_coord = { .x = source.uv.x, .y = source.uv.y };
+    vertices[1].position = { .x = position.x + width, .y = position.y };
+    vertices[1].tex_coord = { .x = source.uv.x + source.uv.w, .y = source.uv.y };
+    vertices[2].position = { .x = position.x + width, .y = position.y + height };
+    vertices[2].tex_coord = { .x = source.uv.x + source.uv.w, .y = source.uv.y + source.uv.h };
+    vertices[3].position = { .x = position.x, .y = position.y + height };
+    vertices[3].tex_coord = { .x = source.uv.x, .y = source.uv.y + source.uv.h };
+}
+}
@@ -0,0 +1,92 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/AssetManifest.hpp"
+#include "iksdl/InvalidParameterException.hpp"
+#include <fstream>
+#include <sstream>
+
+namespace iksdl
+{
+AssetManifest AssetManifest::fromFile(const std::string& filePath)
+{
+    std::ifstream file(filePath);
+    if(!file)
+        throw InvalidParameterException("Unable to read asset manifest at path " + filePath);
+
+    AssetManifest manifest;
+    std::string line;
+    for(int lineNumber = 1 ; std::getline(file, line) ; ++lineNumber)
+    {
+        std::istringstream fields(line.substr(0, line.find('#')));
+
+        std::string type;
+        if(!(fields >> type))
+            continue;
+
+        std::string name, path, group;
+        int priority = 0, ptSize = 0;
+        const bool valid = fields >> name >> path >> group >> priority && (type != "font" || fields >> ptSize);
+
+        if(valid && type == "texture")
+            manifest.addTexture(name, path, group, priority);
+        else if(valid && type == "font")
+            manifest.addFont(name, path, ptSize, group, priority);
+        else if(valid && type == "sound")
+            manifest.addSound(name, path, group, priority);
+        else if(valid && type == "music")
+            manifest.addMusic(name, path, group, priority);
+        else
+            throw InvalidParameterException("Invalid asset at line " + std::to_string(lineNumber) + " of manifest " + filePath);
+    }
+
+    return manifest;
+}
+
+AssetManifest& AssetManifest::addTexture(const std::string& name, const std::string& filePath,
+                                         const std::string& group, int priority)
+{
+    m_assets.push_back(Asset{Type::Texture, name, filePath, group, priority, 0, SoundPolicy()});
+    return *this;
+}
+
+AssetManifest& AssetManifest::addFont(const std::string& name, const std::string& filePath, int ptSize,
+                                      const std::string& group, int priority)
+{
+    m_assets.push_back(Asset{Type::Font, name, filePath, group, priority, ptSize, SoundPolicy()});
+    return *this;
+}
+
+AssetManifest& AssetManifest::addSound(const std::string& name, const std::string& filePath,
+                                       const std::string& group, int priority, const SoundPolicy& policy)
+{
+    m_assets.push_back(Asset{Type::Sound, name, filePath, group, priority, 0, policy});
+    return *this;
+}
+
+AssetManifest& AssetManifest::addMusic(const std::string& name, const std::string& filePath,
+                                       const std::string& group, int priority)
+{
+    m_assets.push_back(Asset{Type::Music, name, filePath, group, priority, 0, SoundPolicy()});
+    return *this;
+}
+}
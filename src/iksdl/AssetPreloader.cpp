@@ -0,0 +1,316 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/AssetPreloader.hpp"
+#include "iksdl/InvalidParameterException.hpp"
+#include "iksdl/JobSystem.hpp"
+#include <algorithm>
+#include <climits>
+#include <exception>
+
+namespace iksdl
+{
+AssetPreloader::AssetPreloader(const Renderer& renderer) :
+    m_renderer(renderer),
+    m_stopping(false),
+    m_submitted(0),
+    m_total(0),
+    m_finished(0)
+{}
+
+AssetPreloader::~AssetPreloader()
+{
+    m_stopping.store(true, std::memory_order_release);
+
+    // the jobs use the preloader until they have finished, their errors
+    // are thrown again by the wait and must not leave the destructor
+    for(const Job& job : m_jobs)
+    {
+        try
+        {
+            JobSystem::wait(job);
+        }
+        catch(...)
+        {}
+    }
+
+    // the decoded images are not owned by any texture yet
+    for(std::vector<Result>* results : {&m_loaded, &m_uploads})
+    {
+        for(Result& result : *results)
+        {
+            if(SDL_Surface** surface = std::get_if<SDL_Surface*>(&result.payload))
+                SDL_FreeSurface(*surface);
+        }
+    }
+}
+
+void AssetPreloader::load(const AssetManifest& manifest)
+{
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+
+        for(const AssetManifest::Asset& asset : manifest.m_assets)
+        {
+            m_waiting.push_back(Entry{asset, m_submitted++});
+            std::push_heap(m_waiting.begin(), m_waiting.end(), comesAfter);
+
+            ++m_groups[asset.group].total;
+        }
+    }
+
+    // each job loads the most important asset waiting when it starts, not a given one
+    std::erase_if(m_jobs, [](const Job& job) { return job.isFinished(); });
+    for(size_t i = 0 ; i < manifest.m_assets.size() ; ++i)
+        m_jobs.push_back(JobSystem::schedule([this]() { loadNext(); }));
+
+    m_total += manifest.m_assets.size();
+}
+
+void AssetPreloader::prioritize(const std::string& group)
+{
+    const auto resultComesAfter = [](const Result& left, const Result& right) { return comesAfter(left.entry, right.entry); };
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    int highest = INT_MIN;
+    for(const Entry& entry : m_waiting)
+        highest = std::max(highest, entry.asset.priority);
+    for(const Result& upload : m_uploads)
+        highest = std::max(highest, upload.entry.asset.priority);
+
+    if(highest == INT_MAX)
+        return;
+
+    for(Entry& entry : m_waiting)
+    {
+        if(entry.asset.group == group)
+            entry.asset.priority = highest + 1;
+    }
+    for(Result& upload : m_uploads)
+    {
+        if(upload.entry.asset.group == group)
+            upload.entry.asset.priority = highest + 1;
+    }
+
+    std::make_heap(m_waiting.begin(), m_waiting.end(), comesAfter);
+    std::make_heap(m_uploads.begin(), m_uploads.end(), resultComesAfter);
+}
+
+size_t AssetPreloader::update(std::chrono::nanoseconds budget)
+{
+    const auto resultComesAfter = [](const Result& left, const Result& right) { return comesAfter(left.entry, right.entry); };
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<Result> loaded;
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        loaded.swap(m_loaded);
+    }
+
+    // Only the textures and the fonts need the main thread, the other assets are already loaded
+    size_t finished = 0;
+    for(Result& result : loaded)
+    {
+        if(std::holds_alternative<SDL_Surface*>(result.payload) || std::holds_alternative<std::monostate>(result.payload))
+        {
+            m_uploads.push_back(std::move(result));
+            std::push_heap(m_uploads.begin(), m_uploads.end(), resultComesAfter);
+        }
+        else
+        {
+            finish(result.entry, std::move(result.payload));
+            ++finished;
+        }
+    }
+
+    while(!m_uploads.empty())
+    {
+        std::pop_heap(m_uploads.begin(), m_uploads.end(), resultComesAfter);
+        Result upload = std::move(m_uploads.back());
+        m_uploads.pop_back();
+
+        finish(upload.entry, std::move(upload.payload));
+        ++finished;
+
+        if(std::chrono::steady_clock::now() - start >= budget)
+            break;
+    }
+
+    return finished;
+}
+
+float AssetPreloader::getProgress() const
+{
+    return m_total == 0 ? 1.f : static_cast<float>(m_finished) / static_cast<float>(m_total);
+}
+
+float AssetPreloader::getProgress(const std::string& group) const
+{
+    const auto found = m_groups.find(group);
+    if(found == m_groups.end())
+        return 1.f;
+
+    return static_cast<float>(found->second.finished) / static_cast<float>(found->second.total);
+}
+
+bool AssetPreloader::isFinished(const std::string& group) const
+{
+    const auto found = m_groups.find(group);
+    return found == m_groups.end() || found->second.finished == found->second.total;
+}
+
+Texture& AssetPreloader::getTexture(const std::string& name)
+{
+    const auto found = m_textures.find(name);
+    if(found == m_textures.end())
+        throw InvalidParameterException("No texture loaded with name " + name);
+
+    return found->second;
+}
+
+Font& AssetPreloader::getFont(const std::string& name)
+{
+    const auto found = m_fonts.find(name);
+    if(found == m_fonts.end())
+        throw InvalidParameterException("No font loaded with name " + name);
+
+    return found->second;
+}
+
+Sound& AssetPreloader::getSound(const std::string& name)
+{
+    const auto found = m_sounds.find(name);
+    if(found == m_sounds.end())
+        throw InvalidParameterException("No sound loaded with name " + name);
+
+    return found->second;
+}
+
+Music& AssetPreloader::getMusic(const std::string& name)
+{
+    const auto found = m_musics.find(name);
+    if(found == m_musics.end())
+        throw InvalidParameterException("No music loaded with name " + name);
+
+    return found->second;
+}
+
+bool AssetPreloader::comesAfter(const Entry& left, const Entry& right)
+{
+    if(left.asset.priority != right.asset.priority)
+        return left.asset.priority < right.asset.priority;
+
+    return left.order > right.order;
+}
+
+AssetPreloader::Payload AssetPreloader::loadAsset(const AssetManifest::Asset& asset)
+{
+    try
+    {
+        switch(asset.type)
+        {
+            case AssetManifest::Type::Texture:
+            {
+                SDL_Surface* const surface = Texture::decode(asset.filePath);
+                if(surface == nullptr)
+                    return Payload(std::in_place_type<std::string>, "Unable to load image at path " + asset.filePath + ". Cause: " + SDL_GetError());
+
+                return surface;
+            }
+
+            case AssetManifest::Type::Font:
+                // SDL_ttf is not thread-safe, the fonts are opened on the main thread
+                return std::monostate();
+
+            case AssetManifest::Type::Sound:
+                return Payload(std::in_place_type<Sound>, asset.filePath, asset.policy);
+
+            case AssetManifest::Type::Music:
+                return Payload(std::in_place_type<Music>, asset.filePath);
+        }
+    }
+    catch(const std::exception& exception)
+    {
+        return Payload(std::in_place_type<std::string>, exception.what());
+    }
+
+    return Payload(std::in_place_type<std::string>, "Unknown type of asset " + asset.name);
+}
+
+void AssetPreloader::finish(const Entry& entry, Payload&& payload)
+{
+    const std::string& name = entry.asset.name;
+
+    if(SDL_Surface** surface = std::get_if<SDL_Surface*>(&payload))
+    {
+        try
+        {
+            m_textures.insert_or_assign(name, Texture(m_renderer, *surface, entry.asset.filePath));
+        }
+        catch(const std::exception& exception)
+        {
+            m_errors.push_back(exception.what());
+        }
+    }
+    else if(std::holds_alternative<std::monostate>(payload))
+    {
+        try
+        {
+            m_fonts.insert_or_assign(name, Font(entry.asset.filePath, entry.asset.ptSize));
+        }
+        catch(const std::exception& exception)
+        {
+            m_errors.push_back(exception.what());
+        }
+    }
+    else if(Sound* sound = std::get_if<Sound>(&payload))
+        m_sounds.insert_or_assign(name, std::move(*sound));
+    else if(Music* music = std::get_if<Music>(&payload))
+        m_musics.insert_or_assign(name, std::move(*music));
+    else
+        m_errors.push_back(std::move(std::get<std::string>(payload)));
+
+    ++m_groups[entry.asset.group].finished;
+    ++m_finished;
+}
+
+void AssetPreloader::loadNext()
+{
+    if(m_stopping.load(std::memory_order_acquire))
+        return;
+
+    Entry entry;
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+
+        std::pop_heap(m_waiting.begin(), m_waiting.end(), comesAfter);
+        entry = std::move(m_waiting.back());
+        m_waiting.pop_back();
+    }
+
+    Payload payload = loadAsset(entry.asset);
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_loaded.push_back(Result{std::move(entry), std::move(payload)});
+}
+}
@@ -0,0 +1,196 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/AudioDevice.hpp"
+#include "iksdl/Channels.hpp"
+#include "iksdl/Initializer.hpp"
+#include "iksdl/Mixer.hpp"
+#include "iksdl/PerformanceCounter.hpp"
+#include "iksdl/SdlException.hpp"
+#include <SDL_mixer.h>
+#include <atomic>
+#include <string>
+
+namespace iksdl
+{
+namespace
+{
+/////////////////////////////////////////////////
+/// \brief Measures of the mixings, written by the audio thread
+/////////////////////////////////////////////////
+struct Monitor
+{
+    std::atomic<bool> open{false};          ///< Is the device opened?
+    std::atomic<int> frequency{0};          ///< Sample rate of the device
+    std::atomic<int> frameSize{0};          ///< Size of a frame in bytes
+    std::atomic<int> bufferSize{0};         ///< Number of frames of the last mixed buffer
+    std::atomic<Uint64> lastMixing{0};      ///< Performance counter at the last mixing
+    std::atomic<int64_t> interval{0};       ///< Time between the last two mixings, in nanoseconds
+    std::atomic<unsigned int> underruns{0}; ///< Number of detected underruns
+};
+
+Monitor& monitor()
+{
+    static Monitor instance;
+    return instance;
+}
+
+/////////////////////////////////////////////////
+/// \brief Post-mix effect measuring the mixings, the stream is not modified
+/////////////////////////////////////////////////
+void measure(int, void*, int length, void*)
+{
+    Monitor& state = monitor();
+
+    const int frames = length / state.frameSize.load(std::memory_order_relaxed);
+    state.bufferSize.store(frames, std::memory_order_relaxed);
+
+    const Uint64 now = SDL_GetPerformanceCounter();
+    const Uint64 last = state.lastMixing.exchange(now, std::memory_order_relaxed);
+    if(last == 0)
+        return;
+
+    const int64_t interval = priv::toNanoseconds(now - last);
+    state.interval.store(interval, std::memory_order_relaxed);
+
+    const int64_t latency = static_cast<int64_t>(frames) * 1'000'000'000 / state.frequency.load(std::memory_order_relaxed);
+    if(interval > 2 * latency)
+        state.underruns.fetch_add(1, std::memory_order_relaxed);
+}
+}
+
+void AudioDevice::open(const AudioDeviceOptions& options)
+{
+    // reopening requires the sounds mixed by the engine to be stopped
+    priv::Mixer* mixer = priv::Mixer::getInstance();
+    const bool mixerInstalled = mixer->isInstalled();
+    close();
+
+    openDevice(options);
+    priv::Initializer::getInstance()->disownAudioDevice();
+
+    if(mixerInstalled)
+        mixer->install();
+}
+
+void AudioDevice::close()
+{
+    Monitor& state = monitor();
+    if(!state.open.load(std::memory_order_acquire))
+        return;
+
+    priv::Mixer::getInstance()->uninstall();
+
+    Mix_CloseAudio();
+    SDL_QuitSubSystem(SDL_INIT_AUDIO);
+
+    state.open.store(false, std::memory_order_release);
+}
+
+bool AudioDevice::isOpen()
+{
+    return monitor().open.load(std::memory_order_acquire);
+}
+
+int AudioDevice::getFrequency()
+{
+    return isOpen() ? monitor().frequency.load(std::memory_order_relaxed) : 0;
+}
+
+int AudioDevice::getChannels()
+{
+    if(!isOpen())
+        return 0;
+
+    int frequency = 0;
+    Uint16 format = 0;
+    int channels = 0;
+    Mix_QuerySpec(&frequency, &format, &channels);
+
+    return channels;
+}
+
+int AudioDevice::getBufferSize()
+{
+    return monitor().bufferSize.load(std::memory_order_relaxed);
+}
+
+std::chrono::nanoseconds AudioDevice::getBufferLatency()
+{
+    const Monitor& state = monitor();
+    const int frequency = state.frequency.load(std::memory_order_relaxed);
+
+    if(frequency == 0)
+        return std::chrono::nanoseconds(0);
+
+    return std::chrono::nanoseconds(static_cast<int64_t>(state.bufferSize.load(std::memory_order_relaxed)) * 1'000'000'000 / frequency);
+}
+
+std::chrono::nanoseconds AudioDevice::getMixingInterval()
+{
+    return std::chrono::nanoseconds(monitor().interval.load(std::memory_order_relaxed));
+}
+
+unsigned int AudioDevice::getUnderrunsCount()
+{
+    return monitor().underruns.load(std::memory_order_relaxed);
+}
+
+void AudioDevice::resetUnderrunsCount()
+{
+    monitor().underruns.store(0, std::memory_order_relaxed);
+}
+
+void AudioDevice::openDevice(const AudioDeviceOptions& options)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    if(SDL_InitSubSystem(SDL_INIT_AUDIO) < 0)
+        throw SdlException(std::string(INIT_AUDIO_ERROR) + SDL_GetError());
+
+    const Uint16 format = options.m_floatSamples ? AUDIO_F32SYS : AUDIO_S16SYS;
+    if(Mix_OpenAudio(options.m_frequency, format, options.m_channels, options.m_bufferSize) < 0)
+    {
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+        throw SdlException(std::string(OPEN_DEVICE_ERROR) + Mix_GetError());
+    }
+
+    priv::Initializer::getInstance()->recordDuration(Subsystems::Type::Audio, std::chrono::steady_clock::now() - start);
+
+    int frequency = 0;
+    Uint16 obtainedFormat = 0;
+    int channels = 0;
+    Mix_QuerySpec(&frequency, &obtainedFormat, &channels);
+
+    Monitor& state = monitor();
+    state.frequency.store(frequency, std::memory_order_relaxed);
+    state.frameSize.store(SDL_AUDIO_BITSIZE(obtainedFormat) / 8 * channels, std::memory_order_relaxed);
+    state.bufferSize.store(0, std::memory_order_relaxed);
+    state.lastMixing.store(0, std::memory_order_relaxed);
+    state.interval.store(0, std::memory_order_relaxed);
+    state.underruns.store(0, std::memory_order_relaxed);
+    state.open.store(true, std::memory_order_release);
+
+    Mix_RegisterEffect(MIX_CHANNEL_POST, measure, nullptr, nullptr);
+    priv::Channels::getInstance()->restore();
+}
+}
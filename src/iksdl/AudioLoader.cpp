@@ -0,0 +1,166 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/AudioLoader.hpp"
+#include "iksdl/JobSystem.hpp"
+#include <algorithm>
+#include <memory>
+
+namespace iksdl
+{
+AudioLoader::AudioLoader() :
+    m_stopping(false),
+    m_pending(0)
+{}
+
+AudioLoader::~AudioLoader()
+{
+    m_stopping.store(true, std::memory_order_release);
+
+    // the jobs use the loader until they have finished, their errors
+    // are thrown again by the wait and must not leave the destructor
+    for(const Job& job : m_jobs)
+    {
+        try
+        {
+            JobSystem::wait(job);
+        }
+        catch(...)
+        {}
+    }
+}
+
+std::future<Sound> AudioLoader::loadSound(const std::string& filePath, const SoundPolicy& policy)
+{
+    auto task = std::make_shared<std::packaged_task<Sound()>>([filePath, policy]() { return Sound(filePath, policy); });
+    std::future<Sound> future = task->get_future();
+
+    submit([task]() { (*task)(); });
+    return future;
+}
+
+void AudioLoader::loadSound(const std::string& filePath,
+                            std::function<void(Sound&&)> onLoaded,
+                            std::function<void(const std::exception&)> onError,
+                            const SoundPolicy& policy)
+{
+    submit(makeTask<Sound>(std::move(onLoaded), std::move(onError), [filePath, policy]() { return Sound(filePath, policy); }));
+}
+
+std::future<Music> AudioLoader::loadMusic(const std::string& filePath)
+{
+    auto task = std::make_shared<std::packaged_task<Music()>>([filePath]() { return Music(filePath); });
+    std::future<Music> future = task->get_future();
+
+    submit([task]() { (*task)(); });
+    return future;
+}
+
+void AudioLoader::loadMusic(const std::string& filePath,
+                            std::function<void(Music&&)> onLoaded,
+                            std::function<void(const std::exception&)> onError)
+{
+    submit(makeTask<Music>(std::move(onLoaded), std::move(onError), [filePath]() { return Music(filePath); }));
+}
+
+size_t AudioLoader::dispatchCompletions()
+{
+    std::vector<std::function<void()>> completions;
+    {
+        const std::lock_guard<std::mutex> lock(m_completionsMutex);
+        completions.swap(m_completions);
+    }
+
+    for(size_t i = 0 ; i < completions.size() ; ++i)
+    {
+        try
+        {
+            completions[i]();
+        }
+        catch(...)
+        {
+            // keep the next callbacks for the next call
+            const std::lock_guard<std::mutex> lock(m_completionsMutex);
+            m_completions.insert(m_completions.begin(),
+                                 std::make_move_iterator(completions.begin() + i + 1),
+                                 std::make_move_iterator(completions.end()));
+            throw;
+        }
+    }
+
+    return completions.size();
+}
+
+void AudioLoader::submit(std::function<void()>&& task)
+{
+    m_pending.fetch_add(1, std::memory_order_release);
+
+    std::erase_if(m_jobs, [](const Job& job) { return job.isFinished(); });
+    m_jobs.push_back(JobSystem::schedule([this, task = std::move(task)]()
+    {
+        // the loads that did not start are abandoned when the loader is destroyed
+        if(!m_stopping.load(std::memory_order_acquire))
+            task();
+
+        m_pending.fetch_sub(1, std::memory_order_release);
+    }));
+}
+
+void AudioLoader::complete(std::function<void()>&& completion)
+{
+    const std::lock_guard<std::mutex> lock(m_completionsMutex);
+    m_completions.push_back(std::move(completion));
+}
+
+template<typename T, typename Load>
+std::function<void()> AudioLoader::makeTask(std::function<void(T&&)>&& onLoaded,
+                                            std::function<void(const std::exception&)>&& onError,
+                                            Load&& load)
+{
+    return [this, onLoaded = std::move(onLoaded), onError = std::move(onError), load = std::forward<Load>(load)]()
+    {
+        try
+        {
+            // std::function needs copyable callbacks
+            auto resource = std::make_shared<T>(load());
+            complete([onLoaded, resource]() { onLoaded(std::move(*resource)); });
+        }
+        catch(const std::exception&)
+        {
+            complete([onError, error = std::current_exception()]()
+            {
+                try
+                {
+                    std::rethrow_exception(error);
+                }
+                catch(const std::exception& exception)
+                {
+                    if(!onError)
+                        throw;
+
+                    onError(exception);
+                }
+            });
+        }
+    };
+}
+}
@@ -0,0 +1,205 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/AudioScene.hpp"
+#include "iksdl/InvalidParameterException.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace iksdl
+{
+AudioScene::AudioScene(const AudioSceneOptions& options) :
+    m_options(options),
+    m_listener(0.f, 0.f),
+    m_audibleCount(0)
+{
+    if(options.m_hearingRange <= 0.f || options.m_fullVolumeDistance < 0.f || options.m_panDistance <= 0.f)
+        throw InvalidParameterException("The distances of an audio scene must be positive");
+
+    if(options.m_fullVolumeDistance >= options.m_hearingRange)
+        throw InvalidParameterException("The full volume distance of an audio scene must be lower than its hearing range");
+}
+
+AudioScene::~AudioScene()
+{
+    for(const Slot& slot : m_slots)
+        slot.voice.stop();
+}
+
+AudioEmitter AudioScene::addEmitter(Sound& sound, const Positionf& position, int loops)
+{
+    uint32_t index;
+    if(m_freeSlots.empty())
+    {
+        index = static_cast<uint32_t>(m_slots.size());
+        m_slots.push_back(Slot{ nullptr, Voice(), 0, 0, 255, 255, false, false });
+        m_x.push_back(0.f);
+        m_y.push_back(0.f);
+        m_left.push_back(0.f);
+        m_right.push_back(0.f);
+    }
+    else
+    {
+        index = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+
+    Slot& slot = m_slots[index];
+    slot = Slot{ &sound, Voice(), loops, slot.generation + 1, 255, 255, false, false };
+    m_x[index] = position.getX();
+    m_y[index] = position.getY();
+
+    return AudioEmitter(index, slot.generation);
+}
+
+void AudioScene::removeEmitter(const AudioEmitter& emitter)
+{
+    if(find(emitter) == nullptr)
+        return;
+
+    Slot& slot = m_slots[emitter.m_index];
+    slot.voice.stop();
+    slot.voice = Voice();
+    slot.sound = nullptr;
+    m_freeSlots.push_back(emitter.m_index);
+}
+
+bool AudioScene::contains(const AudioEmitter& emitter) const
+{
+    return find(emitter) != nullptr;
+}
+
+void AudioScene::setEmitterPosition(const AudioEmitter& emitter, const Positionf& position)
+{
+    if(find(emitter) == nullptr)
+        return;
+
+    m_x[emitter.m_index] = position.getX();
+    m_y[emitter.m_index] = position.getY();
+}
+
+bool AudioScene::isFinished(const AudioEmitter& emitter) const
+{
+    const Slot* slot = find(emitter);
+    return slot != nullptr && slot->finished;
+}
+
+Voice AudioScene::getVoice(const AudioEmitter& emitter) const
+{
+    const Slot* slot = find(emitter);
+    return slot == nullptr ? Voice() : slot->voice;
+}
+
+void AudioScene::update()
+{
+    computeGains();
+
+    m_audibleCount = 0;
+    for(size_t i = 0 ; i < m_slots.size() ; ++i)
+    {
+        Slot& slot = m_slots[i];
+        if(slot.sound == nullptr || slot.finished)
+            continue;
+
+        const bool audible = m_left[i] > 0.f || m_right[i] > 0.f;
+        const bool playing = slot.voice.isValid();
+
+        // a finite sound that stopped, on its own or by going out of range, is never replayed
+        if(slot.started && !playing && slot.loops >= 0)
+        {
+            slot.finished = true;
+            continue;
+        }
+
+        if(!audible)
+        {
+            if(playing)
+            {
+                slot.voice.stop();
+                slot.voice = Voice();
+                slot.finished = slot.loops >= 0;
+            }
+            continue;
+        }
+
+        m_audibleCount++;
+
+        if(!playing)
+        {
+            slot.voice = slot.sound->play(slot.loops);
+            slot.started = slot.voice.isValid() || slot.started;
+            slot.sentLeft = 255;
+            slot.sentRight = 255;
+        }
+
+        const uint8_t left = static_cast<uint8_t>(std::lrint(m_left[i] * 255.f));
+        const uint8_t right = static_cast<uint8_t>(std::lrint(m_right[i] * 255.f));
+        if(left != slot.sentLeft || right != slot.sentRight)
+        {
+            slot.voice.setPanning(left, right);
+            slot.sentLeft = left;
+            slot.sentRight = right;
+        }
+    }
+}
+
+const AudioScene::Slot* AudioScene::find(const AudioEmitter& emitter) const
+{
+    if(emitter.m_index >= m_slots.size())
+        return nullptr;
+
+    const Slot& slot = m_slots[emitter.m_index];
+    if(slot.sound == nullptr || slot.generation != emitter.m_generation)
+        return nullptr;
+
+    return &slot;
+}
+
+void AudioScene::computeGains()
+{
+    const float listenerX = m_listener.getX();
+    const float listenerY = m_listener.getY();
+    const float range = m_options.m_hearingRange;
+    const float inverseFade = 1.f / (m_options.m_hearingRange - m_options.m_fullVolumeDistance);
+    const float inversePan = 1.f / m_options.m_panDistance;
+
+    const float* x = m_x.data();
+    const float* y = m_y.data();
+    float* left = m_left.data();
+    float* right = m_right.data();
+
+    // branchless loop over plain arrays, so that the compiler vectorizes it
+    const size_t count = m_x.size();
+    for(size_t i = 0 ; i < count ; ++i)
+    {
+        const float dx = x[i] - listenerX;
+        const float dy = y[i] - listenerY;
+        const float distance = std::sqrt(dx * dx + dy * dy);
+
+        const float gain = std::min(std::max((range - distance) * inverseFade, 0.f), 1.f);
+        const float pan = std::min(std::max(dx * inversePan, -1.f), 1.f);
+
+        left[i] = gain * std::min(1.f - pan, 1.f);
+        right[i] = gain * std::min(1.f + pan, 1.f);
+    }
+}
+}
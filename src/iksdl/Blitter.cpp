@@ -0,0 +1,253 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/Blitter.hpp"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace iksdl::priv
+{
+namespace
+{
+/////////////////////////////////////////////////
+/// \brief Divide by 255 with rounding, exact for the products of two 8-bit values
+/////////////////////////////////////////////////
+inline uint32_t div255(uint32_t x)
+{
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+/////////////////////////////////////////////////
+/// \brief Multiply each component of a pixel by the matching component of the modulation
+/////////////////////////////////////////////////
+inline uint32_t modulate(uint32_t pixel, uint32_t modulation)
+{
+    return div255((pixel >> 24) * (modulation >> 24)) << 24 |
+           div255(((pixel >> 16) & 0xFF) * ((modulation >> 16) & 0xFF)) << 16 |
+           div255(((pixel >> 8) & 0xFF) * ((modulation >> 8) & 0xFF)) << 8 |
+           div255((pixel & 0xFF) * (modulation & 0xFF));
+}
+
+/////////////////////////////////////////////////
+/// \brief Source-over blending of one pixel, matching SDL_BLENDMODE_BLEND
+/////////////////////////////////////////////////
+inline uint32_t blendPixel(uint32_t d, uint32_t s)
+{
+    const uint32_t sa = s >> 24;
+    const uint32_t ia = 255 - sa;
+
+    return div255(sa * 255 + (d >> 24) * ia) << 24 |
+           div255(((s >> 16) & 0xFF) * sa + ((d >> 16) & 0xFF) * ia) << 16 |
+           div255(((s >> 8) & 0xFF) * sa + ((d >> 8) & 0xFF) * ia) << 8 |
+           div255((s & 0xFF) * sa + (d & 0xFF) * ia);
+}
+
+/////////////////////////////////////////////////
+/// \brief Additive blending of one pixel, matching SDL_BLENDMODE_ADD
+/////////////////////////////////////////////////
+inline uint32_t addPixel(uint32_t d, uint32_t s)
+{
+    const uint32_t sa = s >> 24;
+
+    return (d & 0xFF000000) |
+           std::min(((d >> 16) & 0xFF) + div255(((s >> 16) & 0xFF) * sa), 255u) << 16 |
+           std::min(((d >> 8) & 0xFF) + div255(((s >> 8) & 0xFF) * sa), 255u) << 8 |
+           std::min((d & 0xFF) + div255((s & 0xFF) * sa), 255u);
+}
+
+void blendScalar(uint32_t* dst, const uint32_t* src, int count)
+{
+    for(int i = 0 ; i < count ; ++i)
+        dst[i] = blendPixel(dst[i], src[i]);
+}
+
+void blendModulatedScalar(uint32_t* dst, const uint32_t* src, int count, uint32_t modulation)
+{
+    for(int i = 0 ; i < count ; ++i)
+        dst[i] = blendPixel(dst[i], modulate(src[i], modulation));
+}
+
+void addScalar(uint32_t* dst, const uint32_t* src, int count, uint32_t modulation)
+{
+    for(int i = 0 ; i < count ; ++i)
+        dst[i] = addPixel(dst[i], modulate(src[i], modulation));
+}
+
+void scaleScalar(uint32_t* dst, const uint32_t* src, int count, uint32_t x, uint32_t step)
+{
+    for(int i = 0 ; i < count ; ++i, x += step)
+        dst[i] = src[x >> 16];
+}
+
+constexpr uint32_t NO_MODULATION = 0xFFFFFFFF;
+
+/////////////////////////////////////////////////
+/// \brief Is the pixel format laid out as ARGB8888, with or without alpha?
+/////////////////////////////////////////////////
+inline bool isSupportedFormat(uint32_t format)
+{
+    return format == SDL_PIXELFORMAT_ARGB8888 || format == SDL_PIXELFORMAT_RGB888;
+}
+}
+
+BlitKernels scalarKernels()
+{
+    return BlitKernels { .blend = blendScalar, .blendModulated = blendModulatedScalar,
+                         .add = addScalar, .scale = scaleScalar };
+}
+
+Blitter::Blitter() :
+    m_kernels(scalarKernels())
+{
+#ifdef IKSDL_BLITTER_AVX2
+    if(SDL_HasAVX2())
+    {
+        m_kernels = avx2Kernels();
+        return;
+    }
+#endif
+
+#ifdef IKSDL_BLITTER_SSE41
+    if(SDL_HasSSE41())
+    {
+        m_kernels = sse41Kernels();
+        return;
+    }
+#endif
+
+#ifdef IKSDL_BLITTER_NEON
+    if(SDL_HasNEON())
+        m_kernels = neonKernels();
+#endif
+}
+
+bool Blitter::blit(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Surface& pixels,
+                   const SDL_Rect* sourceRect, const SDL_Rect& destRect) const
+{
+#if SDL_VERSION_ATLEAST(2, 0, 22)
+    // Only draw directly when nothing would be transformed by the renderer
+    if(SDL_GetRenderTarget(renderer) != nullptr || SDL_RenderIsClipEnabled(renderer))
+        return false;
+
+    float scaleX = 1.0f, scaleY = 1.0f;
+    SDL_RenderGetScale(renderer, &scaleX, &scaleY);
+    if(scaleX != 1.0f || scaleY != 1.0f)
+        return false;
+
+    SDL_Window* const window = SDL_RenderGetWindow(renderer);
+    SDL_Surface* const target = window != nullptr ? SDL_GetWindowSurface(window) : nullptr;
+    if(target == nullptr || !isSupportedFormat(target->format->format) || SDL_MUSTLOCK(target))
+        return false;
+
+    // Read blending parameters
+    SDL_BlendMode blendMode = SDL_BLENDMODE_NONE;
+    uint8_t r = 255, g = 255, b = 255, a = 255;
+    SDL_GetTextureBlendMode(texture, &blendMode);
+    SDL_GetTextureColorMod(texture, &r, &g, &b);
+    SDL_GetTextureAlphaMod(texture, &a);
+
+    const uint32_t modulation = static_cast<uint32_t>(a) << 24 | static_cast<uint32_t>(r) << 16 |
+                                static_cast<uint32_t>(g) << 8 | static_cast<uint32_t>(b);
+
+    if(blendMode != SDL_BLENDMODE_BLEND && blendMode != SDL_BLENDMODE_ADD &&
+       (blendMode != SDL_BLENDMODE_NONE || modulation != NO_MODULATION))
+        return false;
+
+    // Check source area
+    const SDL_Rect source = sourceRect != nullptr ? *sourceRect : SDL_Rect { .x = 0, .y = 0, .w = pixels.w, .h = pixels.h };
+    if(source.x < 0 || source.y < 0 || source.w <= 0 || source.h <= 0 ||
+       source.x + source.w > pixels.w || source.y + source.h > pixels.h)
+        return false;
+
+    if(destRect.w <= 0 || destRect.h <= 0)
+        return true;
+
+    // Compute destination area in target coordinates, clipped to the viewport
+    SDL_Rect viewport;
+    SDL_RenderGetViewport(renderer, &viewport);
+
+    const SDL_Rect dest = { .x = destRect.x + viewport.x, .y = destRect.y + viewport.y, .w = destRect.w, .h = destRect.h };
+    const SDL_Rect surfaceRect = { .x = 0, .y = 0, .w = target->w, .h = target->h };
+    SDL_Rect bounds, clipped;
+    if(!SDL_IntersectRect(&viewport, &surfaceRect, &bounds) || !SDL_IntersectRect(&dest, &bounds, &clipped))
+        return true;
+
+    // Make sure previous drawings are done before writing pixels
+    SDL_RenderFlush(renderer);
+
+    const bool scaled = source.w != dest.w || source.h != dest.h;
+    const uint32_t stepX = (static_cast<uint32_t>(source.w) << 16) / static_cast<uint32_t>(dest.w);
+    const uint32_t stepY = (static_cast<uint32_t>(source.h) << 16) / static_cast<uint32_t>(dest.h);
+    const uint32_t startX = static_cast<uint32_t>(clipped.x - dest.x) * stepX + (stepX >> 1);
+
+    thread_local std::vector<uint32_t> scaledRow;
+    if(scaled && blendMode != SDL_BLENDMODE_NONE)
+        scaledRow.resize(static_cast<size_t>(clipped.w));
+
+    for(int y = clipped.y ; y < clipped.y + clipped.h ; ++y)
+    {
+        const int sourceY = scaled ? source.y + static_cast<int>((static_cast<uint32_t>(y - dest.y) * stepY + (stepY >> 1)) >> 16)
+                                   : source.y + y - dest.y;
+
+        const uint32_t* sourceRow = reinterpret_cast<const uint32_t*>(static_cast<const uint8_t*>(pixels.pixels) + sourceY * pixels.pitch) + source.x;
+        uint32_t* const destRow = reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(target->pixels) + y * target->pitch) + clipped.x;
+
+        if(blendMode == SDL_BLENDMODE_NONE)
+        {
+            if(scaled)
+                m_kernels.scale(destRow, sourceRow, clipped.w, startX, stepX);
+            else
+                std::memcpy(destRow, sourceRow + (clipped.x - dest.x), static_cast<size_t>(clipped.w) * sizeof(uint32_t));
+
+            continue;
+        }
+
+        if(scaled)
+        {
+            m_kernels.scale(scaledRow.data(), sourceRow, clipped.w, startX, stepX);
+            sourceRow = scaledRow.data();
+        }
+        else
+            sourceRow += clipped.x - dest.x;
+
+        if(blendMode == SDL_BLENDMODE_ADD)
+            m_kernels.add(destRow, sourceRow, clipped.w, modulation);
+        else if(modulation == NO_MODULATION)
+            m_kernels.blend(destRow, sourceRow, clipped.w);
+        else
+            m_kernels.blendModulated(destRow, sourceRow, clipped.w, modulation);
+    }
+
+    return true;
+#else
+    (void)renderer;
+    (void)texture;
+    (void)pixels;
+    (void)sourceRect;
+    (void)destRect;
+
+    return false;
+#endif
+}
+}
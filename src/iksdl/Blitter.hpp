@@ -0,0 +1,143 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_BLITTER_HPP
+#define IKSDL_BLITTER_HPP
+
+#include <SDL.h>
+#include <cstdint>
+
+namespace iksdl::priv
+{
+
+/////////////////////////////////////////////////
+/// \brief Set of functions that process one row of ARGB8888 pixels
+///
+/// The modulation parameters are ARGB8888 colors that are
+/// multiplied with each source pixel before it is written.
+///
+/// \warning This is IKSDL internal code that should not be
+/// used outside of the library
+/////////////////////////////////////////////////
+struct BlitKernels
+{
+    void (*blend)(uint32_t* dst, const uint32_t* src, int count);                             ///< Source-over alpha blending
+    void (*blendModulated)(uint32_t* dst, const uint32_t* src, int count, uint32_t modulation); ///< Color modulated source-over alpha blending
+    void (*add)(uint32_t* dst, const uint32_t* src, int count, uint32_t modulation);            ///< Additive blending
+    void (*scale)(uint32_t* dst, const uint32_t* src, int count, uint32_t x, uint32_t step);    ///< Nearest-neighbour copy, \a x and \a step are 16.16 fixed point
+};
+
+/////////////////////////////////////////////////
+/// \brief Get the portable kernels
+///
+/// \return Kernels that run on any CPU
+/////////////////////////////////////////////////
+BlitKernels scalarKernels();
+
+#ifdef IKSDL_BLITTER_SSE41
+/////////////////////////////////////////////////
+/// \brief Get the kernels using SSE4.1 instructions
+///
+/// \return Kernels that require SSE4.1
+/////////////////////////////////////////////////
+BlitKernels sse41Kernels();
+#endif
+
+#ifdef IKSDL_BLITTER_AVX2
+/////////////////////////////////////////////////
+/// \brief Get the kernels using AVX2 instructions
+///
+/// \return Kernels that require AVX2
+/////////////////////////////////////////////////
+BlitKernels avx2Kernels();
+#endif
+
+#ifdef IKSDL_BLITTER_NEON
+/////////////////////////////////////////////////
+/// \brief Get the kernels using NEON instructions
+///
+/// \return Kernels that require NEON
+/////////////////////////////////////////////////
+BlitKernels neonKernels();
+#endif
+
+/////////////////////////////////////////////////
+/// \brief Singleton that draws textures directly into the surface of a software renderer
+///
+/// SDL's software renderer blends pixels with generic per-pixel
+/// code. When a texture keeps a copy of its pixels in system memory,
+/// the common cases are handled here with vectorized kernels chosen
+/// at runtime according to the CPU features.
+///
+/// \warning This is IKSDL internal code that should not be
+/// used outside of the library
+/////////////////////////////////////////////////
+class Blitter
+{
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Get the singleton instance
+        ///
+        /// \return Singleton instance
+        /////////////////////////////////////////////////
+        inline static const Blitter& getInstance() { static const Blitter blitter; return blitter; }
+
+        /////////////////////////////////////////////////
+        /// \brief Draw a texture into the target of a software renderer
+        ///
+        /// Only the situations that the kernels handle exactly like
+        /// SDL are processed: the renderer must draw into its window
+        /// surface, without scaling nor clipping, and the texture must use
+        /// no blending, alpha blending or additive blending.
+        ///
+        /// \param renderer   Software renderer to draw with
+        /// \param texture    Texture to draw, used to read blending parameters
+        /// \param pixels     Copy of the texture pixels in ARGB8888 format
+        /// \param sourceRect Part of the texture to draw, or nullptr for the full texture
+        /// \param destRect   Position and size of the drawing in the current viewport
+        ///
+        /// \return False if the drawing must be done by SDL instead
+        /////////////////////////////////////////////////
+        bool blit(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Surface& pixels,
+                  const SDL_Rect* sourceRect, const SDL_Rect& destRect) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Get the kernels selected for the current CPU
+        ///
+        /// \return Selected kernels
+        /////////////////////////////////////////////////
+        inline const BlitKernels& getKernels() const { return m_kernels; }
+
+    private:
+
+        /////////////////////////////////////////////////
+        /// \brief Default constructor, selecting the best kernels for the current CPU
+        /////////////////////////////////////////////////
+        Blitter();
+
+        BlitKernels m_kernels; ///< Kernels used to process pixels
+};
+
+}
+
+#endif // IKSDL_BLITTER_HPP
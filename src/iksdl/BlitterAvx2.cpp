@@ -0,0 +1,177 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/Blitter.hpp"
+#include <immintrin.h>
+
+namespace iksdl::priv
+{
+namespace
+{
+/////////////////////////////////////////////////
+/// \brief Get the kernels used for the pixels that do not fill a whole register
+/////////////////////////////////////////////////
+inline const BlitKernels& scalar()
+{
+    static const BlitKernels kernels = scalarKernels();
+    return kernels;
+}
+
+/////////////////////////////////////////////////
+/// \brief Divide each 16-bit lane by 255 with rounding
+/////////////////////////////////////////////////
+inline __m256i div255(__m256i x)
+{
+    x = _mm256_add_epi16(x, _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)), 8);
+}
+
+/////////////////////////////////////////////////
+/// \brief Copy the alpha of each pixel to all of its 16-bit lanes
+/////////////////////////////////////////////////
+inline __m256i broadcastAlpha(__m256i x)
+{
+    return _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(x, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+/////////////////////////////////////////////////
+/// \brief Blend four pixels unpacked to 16-bit lanes
+/////////////////////////////////////////////////
+inline __m256i blend16(__m256i d, __m256i s)
+{
+    const __m256i alpha = broadcastAlpha(s);
+    const __m256i srcFactor = _mm256_blend_epi16(alpha, _mm256_set1_epi16(255), 0x88);
+    const __m256i dstFactor = _mm256_sub_epi16(_mm256_set1_epi16(255), alpha);
+
+    return div255(_mm256_add_epi16(_mm256_mullo_epi16(s, srcFactor), _mm256_mullo_epi16(d, dstFactor)));
+}
+
+/////////////////////////////////////////////////
+/// \brief Blend eight pixels
+/////////////////////////////////////////////////
+inline __m256i blend(__m256i d, __m256i s)
+{
+    const __m256i zero = _mm256_setzero_si256();
+
+    return _mm256_packus_epi16(blend16(_mm256_unpacklo_epi8(d, zero), _mm256_unpacklo_epi8(s, zero)),
+                               blend16(_mm256_unpackhi_epi8(d, zero), _mm256_unpackhi_epi8(s, zero)));
+}
+
+/////////////////////////////////////////////////
+/// \brief Modulate eight pixels
+/////////////////////////////////////////////////
+inline __m256i modulate(__m256i s, __m256i modulation16)
+{
+    const __m256i zero = _mm256_setzero_si256();
+
+    return _mm256_packus_epi16(div255(_mm256_mullo_epi16(_mm256_unpacklo_epi8(s, zero), modulation16)),
+                               div255(_mm256_mullo_epi16(_mm256_unpackhi_epi8(s, zero), modulation16)));
+}
+
+void blendAvx2(uint32_t* dst, const uint32_t* src, int count)
+{
+    const __m256i alphaMask = _mm256_set1_epi32(static_cast<int>(0xFF000000));
+
+    int i = 0;
+    for( ; i + 8 <= count ; i += 8)
+    {
+        const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const int opaque = _mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_and_si256(s, alphaMask), alphaMask));
+
+        // Skip the computations for fully opaque or fully transparent pixels
+        if(opaque == -1)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), s);
+            continue;
+        }
+        if(_mm256_testz_si256(s, alphaMask))
+            continue;
+
+        const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), blend(d, s));
+    }
+
+    scalar().blend(dst + i, src + i, count - i);
+}
+
+void blendModulatedAvx2(uint32_t* dst, const uint32_t* src, int count, uint32_t modulation)
+{
+    const __m256i modulation16 = _mm256_unpacklo_epi8(_mm256_set1_epi32(static_cast<int>(modulation)), _mm256_setzero_si256());
+
+    int i = 0;
+    for( ; i + 8 <= count ; i += 8)
+    {
+        const __m256i s = modulate(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)), modulation16);
+        const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), blend(d, s));
+    }
+
+    scalar().blendModulated(dst + i, src + i, count - i, modulation);
+}
+
+void addAvx2(uint32_t* dst, const uint32_t* src, int count, uint32_t modulation)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i modulation16 = _mm256_unpacklo_epi8(_mm256_set1_epi32(static_cast<int>(modulation)), zero);
+
+    int i = 0;
+    for( ; i + 8 <= count ; i += 8)
+    {
+        const __m256i s = modulate(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)), modulation16);
+        const __m256i sLo = _mm256_unpacklo_epi8(s, zero);
+        const __m256i sHi = _mm256_unpackhi_epi8(s, zero);
+
+        // The alpha of the destination is kept as is
+        const __m256i added = _mm256_packus_epi16(div255(_mm256_mullo_epi16(sLo, _mm256_blend_epi16(broadcastAlpha(sLo), zero, 0x88))),
+                                                  div255(_mm256_mullo_epi16(sHi, _mm256_blend_epi16(broadcastAlpha(sHi), zero, 0x88))));
+
+        const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_adds_epu8(d, added));
+    }
+
+    scalar().add(dst + i, src + i, count - i, modulation);
+}
+
+void scaleAvx2(uint32_t* dst, const uint32_t* src, int count, uint32_t x, uint32_t step)
+{
+    const __m256i laneSteps = _mm256_mullo_epi32(_mm256_set1_epi32(static_cast<int>(step)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    const __m256i registerStep = _mm256_set1_epi32(static_cast<int>(step * 8));
+    __m256i positions = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(x)), laneSteps);
+
+    int i = 0;
+    for( ; i + 8 <= count ; i += 8)
+    {
+        const __m256i pixels = _mm256_i32gather_epi32(reinterpret_cast<const int*>(src), _mm256_srli_epi32(positions, 16), 4);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), pixels);
+        positions = _mm256_add_epi32(positions, registerStep);
+    }
+
+    scalar().scale(dst + i, src, count - i, x + static_cast<uint32_t>(i) * step, step);
+}
+}
+
+BlitKernels avx2Kernels()
+{
+    return BlitKernels { .blend = blendAvx2, .blendModulated = blendModulatedAvx2,
+                         .add = addAvx2, .scale = scaleAvx2 };
+}
+}
@@ -0,0 +1,144 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/Blitter.hpp"
+#include <arm_neon.h>
+
+namespace iksdl::priv
+{
+namespace
+{
+/////////////////////////////////////////////////
+/// \brief Get the kernels used for the pixels that do not fill a whole register
+/////////////////////////////////////////////////
+inline const BlitKernels& scalar()
+{
+    static const BlitKernels kernels = scalarKernels();
+    return kernels;
+}
+
+/////////////////////////////////////////////////
+/// \brief Divide each 16-bit lane by 255 with rounding and narrow to 8 bits
+/////////////////////////////////////////////////
+inline uint8x8_t div255(uint16x8_t x)
+{
+    return vrshrn_n_u16(vrsraq_n_u16(x, x, 8), 8);
+}
+
+/////////////////////////////////////////////////
+/// \brief Copy the alpha of each pixel to all of its bytes
+/////////////////////////////////////////////////
+inline uint8x16_t broadcastAlpha(uint8x16_t x)
+{
+    static const uint8_t indices[16] = { 3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15 };
+    return vqtbl1q_u8(x, vld1q_u8(indices));
+}
+
+/////////////////////////////////////////////////
+/// \brief Multiply two sets of four pixels
+/////////////////////////////////////////////////
+inline uint8x16_t multiply(uint8x16_t a, uint8x16_t b)
+{
+    return vcombine_u8(div255(vmull_u8(vget_low_u8(a), vget_low_u8(b))), div255(vmull_high_u8(a, b)));
+}
+
+/////////////////////////////////////////////////
+/// \brief Blend four pixels
+/////////////////////////////////////////////////
+inline uint8x16_t blend(uint8x16_t d, uint8x16_t s)
+{
+    const uint8x16_t alpha = broadcastAlpha(s);
+    const uint8x16_t srcFactor = vorrq_u8(alpha, vreinterpretq_u8_u32(vdupq_n_u32(0xFF000000)));
+    const uint8x16_t dstFactor = vmvnq_u8(alpha);
+
+    const uint16x8_t lo = vmlal_u8(vmull_u8(vget_low_u8(s), vget_low_u8(srcFactor)), vget_low_u8(d), vget_low_u8(dstFactor));
+    const uint16x8_t hi = vmlal_high_u8(vmull_high_u8(s, srcFactor), d, dstFactor);
+
+    return vcombine_u8(div255(lo), div255(hi));
+}
+
+void blendNeon(uint32_t* dst, const uint32_t* src, int count)
+{
+    int i = 0;
+    for( ; i + 4 <= count ; i += 4)
+    {
+        const uint8x16_t s = vreinterpretq_u8_u32(vld1q_u32(src + i));
+        const uint32x4_t alpha = vshrq_n_u32(vreinterpretq_u32_u8(s), 24);
+
+        // Skip the computations for fully opaque or fully transparent pixels
+        if(vminvq_u32(alpha) == 255)
+        {
+            vst1q_u32(dst + i, vreinterpretq_u32_u8(s));
+            continue;
+        }
+        if(vmaxvq_u32(alpha) == 0)
+            continue;
+
+        const uint8x16_t d = vreinterpretq_u8_u32(vld1q_u32(dst + i));
+        vst1q_u32(dst + i, vreinterpretq_u32_u8(blend(d, s)));
+    }
+
+    scalar().blend(dst + i, src + i, count - i);
+}
+
+void blendModulatedNeon(uint32_t* dst, const uint32_t* src, int count, uint32_t modulation)
+{
+    const uint8x16_t modulation8 = vreinterpretq_u8_u32(vdupq_n_u32(modulation));
+
+    int i = 0;
+    for( ; i + 4 <= count ; i += 4)
+    {
+        const uint8x16_t s = multiply(vreinterpretq_u8_u32(vld1q_u32(src + i)), modulation8);
+        const uint8x16_t d = vreinterpretq_u8_u32(vld1q_u32(dst + i));
+        vst1q_u32(dst + i, vreinterpretq_u32_u8(blend(d, s)));
+    }
+
+    scalar().blendModulated(dst + i, src + i, count - i, modulation);
+}
+
+void addNeon(uint32_t* dst, const uint32_t* src, int count, uint32_t modulation)
+{
+    const uint8x16_t modulation8 = vreinterpretq_u8_u32(vdupq_n_u32(modulation));
+    const uint8x16_t colorMask = vreinterpretq_u8_u32(vdupq_n_u32(0x00FFFFFF));
+
+    int i = 0;
+    for( ; i + 4 <= count ; i += 4)
+    {
+        const uint8x16_t s = multiply(vreinterpretq_u8_u32(vld1q_u32(src + i)), modulation8);
+
+        // The alpha of the destination is kept as is
+        const uint8x16_t added = multiply(s, vandq_u8(broadcastAlpha(s), colorMask));
+
+        const uint8x16_t d = vreinterpretq_u8_u32(vld1q_u32(dst + i));
+        vst1q_u32(dst + i, vreinterpretq_u32_u8(vqaddq_u8(d, added)));
+    }
+
+    scalar().add(dst + i, src + i, count - i, modulation);
+}
+}
+
+BlitKernels neonKernels()
+{
+    return BlitKernels { .blend = blendNeon, .blendModulated = blendModulatedNeon,
+                         .add = addNeon, .scale = scalar().scale };
+}
+}
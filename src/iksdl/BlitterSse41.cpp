@@ -0,0 +1,160 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/Blitter.hpp"
+#include <smmintrin.h>
+
+namespace iksdl::priv
+{
+namespace
+{
+/////////////////////////////////////////////////
+/// \brief Get the kernels used for the pixels that do not fill a whole register
+/////////////////////////////////////////////////
+inline const BlitKernels& scalar()
+{
+    static const BlitKernels kernels = scalarKernels();
+    return kernels;
+}
+
+/////////////////////////////////////////////////
+/// \brief Divide each 16-bit lane by 255 with rounding
+/////////////////////////////////////////////////
+inline __m128i div255(__m128i x)
+{
+    x = _mm_add_epi16(x, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+
+/////////////////////////////////////////////////
+/// \brief Copy the alpha of each pixel to all of its 16-bit lanes
+/////////////////////////////////////////////////
+inline __m128i broadcastAlpha(__m128i x)
+{
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+/////////////////////////////////////////////////
+/// \brief Blend two pixels unpacked to 16-bit lanes
+/////////////////////////////////////////////////
+inline __m128i blend16(__m128i d, __m128i s)
+{
+    const __m128i alpha = broadcastAlpha(s);
+    const __m128i srcFactor = _mm_blend_epi16(alpha, _mm_set1_epi16(255), 0x88);
+    const __m128i dstFactor = _mm_sub_epi16(_mm_set1_epi16(255), alpha);
+
+    return div255(_mm_add_epi16(_mm_mullo_epi16(s, srcFactor), _mm_mullo_epi16(d, dstFactor)));
+}
+
+/////////////////////////////////////////////////
+/// \brief Blend four pixels
+/////////////////////////////////////////////////
+inline __m128i blend(__m128i d, __m128i s)
+{
+    const __m128i zero = _mm_setzero_si128();
+
+    return _mm_packus_epi16(blend16(_mm_unpacklo_epi8(d, zero), _mm_unpacklo_epi8(s, zero)),
+                            blend16(_mm_unpackhi_epi8(d, zero), _mm_unpackhi_epi8(s, zero)));
+}
+
+/////////////////////////////////////////////////
+/// \brief Modulate four pixels
+/////////////////////////////////////////////////
+inline __m128i modulate(__m128i s, __m128i modulation16)
+{
+    const __m128i zero = _mm_setzero_si128();
+
+    return _mm_packus_epi16(div255(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), modulation16)),
+                            div255(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), modulation16)));
+}
+
+void blendSse41(uint32_t* dst, const uint32_t* src, int count)
+{
+    const __m128i alphaMask = _mm_set1_epi32(static_cast<int>(0xFF000000));
+
+    int i = 0;
+    for( ; i + 4 <= count ; i += 4)
+    {
+        const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const int opaque = _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(s, alphaMask), alphaMask));
+
+        // Skip the computations for fully opaque or fully transparent pixels
+        if(opaque == 0xFFFF)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), s);
+            continue;
+        }
+        if(_mm_testz_si128(s, alphaMask))
+            continue;
+
+        const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), blend(d, s));
+    }
+
+    scalar().blend(dst + i, src + i, count - i);
+}
+
+void blendModulatedSse41(uint32_t* dst, const uint32_t* src, int count, uint32_t modulation)
+{
+    const __m128i modulation16 = _mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(modulation)), _mm_setzero_si128());
+
+    int i = 0;
+    for( ; i + 4 <= count ; i += 4)
+    {
+        const __m128i s = modulate(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), modulation16);
+        const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), blend(d, s));
+    }
+
+    scalar().blendModulated(dst + i, src + i, count - i, modulation);
+}
+
+void addSse41(uint32_t* dst, const uint32_t* src, int count, uint32_t modulation)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulation16 = _mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(modulation)), zero);
+
+    int i = 0;
+    for( ; i + 4 <= count ; i += 4)
+    {
+        const __m128i s = modulate(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), modulation16);
+        const __m128i sLo = _mm_unpacklo_epi8(s, zero);
+        const __m128i sHi = _mm_unpackhi_epi8(s, zero);
+
+        // The alpha of the destination is kept as is
+        const __m128i added = _mm_packus_epi16(div255(_mm_mullo_epi16(sLo, _mm_blend_epi16(broadcastAlpha(sLo), zero, 0x88))),
+                                               div255(_mm_mullo_epi16(sHi, _mm_blend_epi16(broadcastAlpha(sHi), zero, 0x88))));
+
+        const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_adds_epu8(d, added));
+    }
+
+    scalar().add(dst + i, src + i, count - i, modulation);
+}
+}
+
+BlitKernels sse41Kernels()
+{
+    return BlitKernels { .blend = blendSse41, .blendModulated = blendModulatedSse41,
+                         .add = addSse41, .scale = scalar().scale };
+}
+}
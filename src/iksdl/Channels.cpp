@@ -22,32 +22,107 @@
 
 #include "iksdl/Channels.hpp"
 #include <SDL_mixer.h>
+#include <algorithm>
 
 namespace iksdl::priv
 {
 Channels::Channels() :
-    m_channels(Mix_AllocateChannels(-1), false)
+    m_next(new std::atomic<int32_t>[MAX_CHANNELS]),
+    m_reserved(new std::atomic<bool>[MAX_CHANNELS]),
+    m_head(static_cast<uint32_t>(NO_CHANNEL)),
+    m_count(std::clamp(Mix_AllocateChannels(-1), 0, MAX_CHANNELS))
 {
+    for(int i = 0 ; i < MAX_CHANNELS ; ++i)
+    {
+        m_next[i].store(NO_CHANNEL, std::memory_order_relaxed);
+        m_reserved[i].store(false, std::memory_order_relaxed);
+    }
+
+    // Push in reverse order so that the lowest channels are reserved first
+    for(int i = m_count.load(std::memory_order_relaxed) - 1 ; i >= 0 ; --i)
+        push(i);
+
+    Mix_ChannelFinished(freeChannel);
+}
+
+void Channels::restore()
+{
+    std::lock_guard<std::mutex> lock(m_allocationMutex);
+
+    Mix_AllocateChannels(m_count.load(std::memory_order_relaxed));
     Mix_ChannelFinished(freeChannel);
 }
 
 int Channels::reserve()
 {
-    const size_t channelsCount = m_channels.size();
-    for(size_t i = 0 ; i < channelsCount ; ++i)
+    int32_t channel = pop();
+
+    if(channel == NO_CHANNEL)
     {
-        if(!m_channels[i])
+        std::lock_guard<std::mutex> lock(m_allocationMutex);
+
+        // Another thread may have allocated channels meanwhile
+        channel = pop();
+        if(channel == NO_CHANNEL)
         {
-            m_channels[i] = true;
-            return static_cast<int>(i);
+            const int count = m_count.load(std::memory_order_relaxed);
+            if(count >= MAX_CHANNELS)
+                return NO_CHANNEL;
+
+            const int newCount = std::min(std::max(count * 2, MIN_CHANNELS), MAX_CHANNELS);
+            Mix_AllocateChannels(newCount);
+            m_count.store(newCount, std::memory_order_release);
+
+            for(int i = newCount - 1 ; i > count ; --i)
+                push(i);
+
+            channel = count;
         }
     }
 
-    // If we arrive here, it means that we could not find an available channel
-    Mix_AllocateChannels(static_cast<int>(channelsCount) + ALLOCATION_STEP);
-    m_channels.push_back(true);
-    m_channels.push_back(false);
+    m_reserved[channel].store(true, std::memory_order_relaxed);
+    return channel;
+}
+
+void Channels::free(int channel)
+{
+    if(channel < 0 || channel >= m_count.load(std::memory_order_acquire))
+        return;
+
+    if(m_reserved[channel].exchange(false, std::memory_order_acq_rel))
+        push(channel);
+}
+
+void Channels::push(int32_t channel)
+{
+    uint64_t head = m_head.load(std::memory_order_relaxed);
+    uint64_t newHead = 0;
+
+    do
+    {
+        m_next[channel].store(static_cast<int32_t>(head & 0xFFFFFFFF), std::memory_order_relaxed);
+        newHead = ((head >> 32) + 1) << 32 | static_cast<uint32_t>(channel);
+    }
+    while(!m_head.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+}
+
+int32_t Channels::pop()
+{
+    uint64_t head = m_head.load(std::memory_order_acquire);
+    uint64_t newHead = 0;
+
+    do
+    {
+        const int32_t channel = static_cast<int32_t>(head & 0xFFFFFFFF);
+        if(channel == NO_CHANNEL)
+            return NO_CHANNEL;
+
+        // The counter in the high bits prevents the ABA problem
+        const auto next = static_cast<uint32_t>(m_next[channel].load(std::memory_order_relaxed));
+        newHead = ((head >> 32) + 1) << 32 | next;
+    }
+    while(!m_head.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_acquire));
 
-    return static_cast<int>(channelsCount);
+    return static_cast<int32_t>(head & 0xFFFFFFFF);
 }
 }
@@ -24,7 +24,8 @@
 
 namespace iksdl
 {
-Event::Event(std::unique_ptr<AbstractEvent> event) :
-    m_event(std::move(event))
-{}
+void Event::play(EventHandler& handler) const
+{
+    visit([&handler](const auto& event) { event.play(handler); });
+}
 }
@@ -0,0 +1,87 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_EVENT_LOG_HPP
+#define IKSDL_EVENT_LOG_HPP
+
+#include <SDL.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace iksdl::priv
+{
+
+/////////////////////////////////////////////////
+/// \brief Description of the binary format of event logs
+///
+/// A log starts with \a MAGIC, followed by the records. Each
+/// record is made of the number of frames since the previous
+/// record, as an unsigned LEB128 integer, the size of the
+/// event data on one byte, then the data of the SDL event,
+/// truncated to the structure of its type. Values are stored
+/// in the byte order of the recording machine.
+///
+/// \warning This is IKSDL internal code that should not be
+/// used outside of the library
+/////////////////////////////////////////////////
+struct EventLog
+{
+    static constexpr std::array<char, 8> MAGIC = { 'I', 'K', 'S', 'D', 'L', 'E', 'V', '1' }; ///< Beginning of every log
+
+    /////////////////////////////////////////////////
+    /// \brief Get the number of bytes to record for an event
+    ///
+    /// Only the events that can be replayed are recorded,
+    /// the others may contain pointers.
+    ///
+    /// \param event SDL event
+    ///
+    /// \return Number of bytes to record, or 0 if the event must not be recorded
+    /////////////////////////////////////////////////
+    static constexpr size_t getRecordedSize(const SDL_Event& event)
+    {
+        switch(event.type)
+        {
+            case SDL_QUIT:
+                return sizeof(SDL_QuitEvent);
+            case SDL_WINDOWEVENT:
+                return sizeof(SDL_WindowEvent);
+            case SDL_KEYDOWN:
+            case SDL_KEYUP:
+                return sizeof(SDL_KeyboardEvent);
+            case SDL_MOUSEMOTION:
+                return sizeof(SDL_MouseMotionEvent);
+            case SDL_MOUSEBUTTONDOWN:
+            case SDL_MOUSEBUTTONUP:
+                return sizeof(SDL_MouseButtonEvent);
+            case SDL_MOUSEWHEEL:
+                return sizeof(SDL_MouseWheelEvent);
+            default:
+                return 0;
+        }
+    }
+};
+
+}
+
+#endif // IKSDL_EVENT_LOG_HPP
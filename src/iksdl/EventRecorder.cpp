@@ -0,0 +1,82 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/EventRecorder.hpp"
+#include "iksdl/EventLog.hpp"
+#include "iksdl/EventRouter.hpp"
+#include "iksdl/InvalidParameterException.hpp"
+
+namespace iksdl
+{
+EventRecorder::EventRecorder(const std::string& filePath) :
+    m_file(checkInactive(filePath), std::ios::binary | std::ios::trunc),
+    m_frame(0),
+    m_recordedFrame(0)
+{
+    if(!m_file)
+        throw InvalidParameterException("Unable to open event log at path " + filePath);
+
+    m_file.write(priv::EventLog::MAGIC.data(), priv::EventLog::MAGIC.size());
+    priv::EventRouter::getInstance()->setRecorder(this);
+}
+
+EventRecorder::~EventRecorder()
+{
+    priv::EventRouter* router = priv::EventRouter::getInstance();
+    if(router->getRecorder() == this)
+        router->setRecorder(nullptr);
+}
+
+const std::string& EventRecorder::checkInactive(const std::string& filePath)
+{
+    // the file must not be truncated, it may be the log of the active recorder
+    if(priv::EventRouter::getInstance()->getRecorder() != nullptr)
+        throw InvalidParameterException("Another event recorder is already active");
+
+    return filePath;
+}
+
+void EventRecorder::record(const SDL_Event& event)
+{
+    const size_t size = priv::EventLog::getRecordedSize(event);
+    if(size == 0)
+        return;
+
+    // Number of frames since the previous record, as LEB128
+    uint32_t delta = m_frame - m_recordedFrame;
+    do
+    {
+        uint8_t byte = delta & 0x7F;
+        delta >>= 7;
+        if(delta != 0)
+            byte |= 0x80;
+
+        m_file.put(static_cast<char>(byte));
+    }
+    while(delta != 0);
+
+    m_file.put(static_cast<char>(size));
+    m_file.write(reinterpret_cast<const char*>(&event), static_cast<std::streamsize>(size));
+
+    m_recordedFrame = m_frame;
+}
+}
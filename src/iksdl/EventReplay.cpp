@@ -0,0 +1,86 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/EventReplay.hpp"
+#include "iksdl/EventLog.hpp"
+#include "iksdl/InvalidParameterException.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+namespace iksdl
+{
+EventReplay::EventReplay(const std::string& filePath) :
+    m_next(0),
+    m_frame(0)
+{
+    std::ifstream file(filePath, std::ios::binary);
+    if(!file)
+        throw InvalidParameterException("Unable to open event log at path " + filePath);
+
+    const std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    const std::string invalidLog = "Invalid event log at path " + filePath;
+
+    if(data.size() < priv::EventLog::MAGIC.size() ||
+       !std::equal(priv::EventLog::MAGIC.begin(), priv::EventLog::MAGIC.end(), data.begin()))
+        throw InvalidParameterException(invalidLog);
+
+    size_t position = priv::EventLog::MAGIC.size();
+    uint32_t frame = 0;
+
+    while(position < data.size())
+    {
+        // Number of frames since the previous record, as LEB128
+        uint32_t delta = 0;
+        unsigned int shift = 0;
+        uint8_t byte = 0;
+        do
+        {
+            if(position >= data.size() || shift > 28)
+                throw InvalidParameterException(invalidLog);
+
+            byte = static_cast<uint8_t>(data[position++]);
+            delta |= static_cast<uint32_t>(byte & 0x7F) << shift;
+            shift += 7;
+        }
+        while(byte & 0x80);
+
+        if(position >= data.size())
+            throw InvalidParameterException(invalidLog);
+
+        const size_t size = static_cast<uint8_t>(data[position++]);
+        if(size == 0 || size > sizeof(SDL_Event) || position + size > data.size())
+            throw InvalidParameterException(invalidLog);
+
+        frame += delta;
+
+        Record record{ frame, SDL_Event() };
+        std::copy_n(data.begin() + static_cast<std::ptrdiff_t>(position), size, reinterpret_cast<char*>(&record.event));
+        position += size;
+
+        if(priv::EventLog::getRecordedSize(record.event) != size)
+            throw InvalidParameterException(invalidLog);
+
+        m_records.push_back(record);
+    }
+}
+}
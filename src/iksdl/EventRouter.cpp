@@ -0,0 +1,319 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/EventRouter.hpp"
+#include "iksdl/EventRecorder.hpp"
+#include "iksdl/UserEventQueue.hpp"
+
+namespace iksdl::priv
+{
+EventRouter* EventRouter::getInstance()
+{
+    static EventRouter router;
+    return &router;
+}
+
+EventRouter::EventRouter() :
+    m_recorder(nullptr)
+{}
+
+void EventRouter::registerWindow(uint32_t windowId)
+{
+    if(findQueue(windowId) != nullptr)
+        return;
+
+    m_queues.push_back({ windowId, std::vector<SDL_Event>(INITIAL_QUEUE_SIZE), 0, 0, EventCoalescing() });
+
+    // The user events posted before any window was opened are waiting for this one
+    if(m_queues.size() == 1)
+        routeUserEvents(*UserEventQueue::getInstance());
+}
+
+void EventRouter::unregisterWindow(uint32_t windowId)
+{
+    for(auto it = m_queues.begin() ; it != m_queues.end() ; ++it)
+    {
+        if(it->windowId == windowId)
+        {
+            // Destroy the payloads of the user events that will never be handled
+            const uint32_t userEventType = UserEventQueue::getInstance()->getWakeUpType();
+            SDL_Event event;
+            while(pop(*it, event))
+            {
+                if(event.type == userEventType && event.user.data1 != nullptr)
+                    UserEventQueue::release(static_cast<UserEventQueue::Node*>(event.user.data1));
+            }
+
+            m_queues.erase(it);
+            return;
+        }
+    }
+}
+
+void EventRouter::setCoalescing(uint32_t windowId, const EventCoalescing& coalescing)
+{
+    if(WindowQueue* queue = findQueue(windowId) ; queue != nullptr)
+        queue->coalescing = coalescing;
+}
+
+bool EventRouter::poll(uint32_t windowId, SDL_Event& event)
+{
+    WindowQueue* queue = findQueue(windowId);
+    if(queue == nullptr)
+        return false;
+
+    if(!pop(*queue, event))
+    {
+        pump();
+        if(!pop(*queue, event))
+            return false;
+    }
+
+    if(m_recorder != nullptr)
+        m_recorder->record(event);
+
+    return true;
+}
+
+bool EventRouter::wait(uint32_t windowId, SDL_Event& event)
+{
+    if(findQueue(windowId) == nullptr)
+        return false;
+
+    while(!poll(windowId, event))
+    {
+        // only wait for an event to be available, it is routed by the next poll
+        if(SDL_WaitEvent(nullptr) == 0)
+            return false;
+    }
+
+    return true;
+}
+
+void EventRouter::pump()
+{
+    SDL_PumpEvents();
+
+    SDL_Event events[PUMP_BATCH_SIZE];
+    int count = 0;
+    UserEventQueue* userEvents = UserEventQueue::getInstance();
+
+    do
+    {
+        count = SDL_PeepEvents(events, PUMP_BATCH_SIZE, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+        for(int i = 0 ; i < count ; ++i)
+        {
+            if(events[i].type == userEvents->getWakeUpType())
+            {
+                routeUserEvents(*userEvents);
+                continue;
+            }
+
+            const uint32_t windowId = getTargetWindow(events[i]);
+
+            if(windowId == 0 && isGlobal(events[i]))
+            {
+                for(WindowQueue& queue : m_queues)
+                    push(queue, events[i]);
+            }
+            else if(WindowQueue* queue = windowId == 0 ? findFocusedQueue() : findQueue(windowId) ; queue != nullptr)
+            {
+                if(!coalesce(*queue, events[i]))
+                    push(*queue, events[i]);
+            }
+        }
+    }
+    while(count == PUMP_BATCH_SIZE);
+}
+
+void EventRouter::routeUserEvents(UserEventQueue& userEvents)
+{
+    userEvents.acknowledgeWakeUp();
+
+    // Without any window, the user events stay posted until the first one is registered
+    if(m_queues.empty())
+        return;
+
+    // User events go to the first opened window, the payload stays in its node
+    while(UserEventQueue::Node* node = userEvents.take())
+    {
+        SDL_Event event{};
+        event.type = userEvents.getWakeUpType();
+        event.user.data1 = node;
+        push(m_queues.front(), event);
+    }
+}
+
+EventRouter::WindowQueue* EventRouter::findQueue(uint32_t windowId)
+{
+    for(WindowQueue& queue : m_queues)
+    {
+        if(queue.windowId == windowId)
+            return &queue;
+    }
+
+    return nullptr;
+}
+
+EventRouter::WindowQueue* EventRouter::findFocusedQueue()
+{
+    if(m_queues.empty())
+        return nullptr;
+
+    if(SDL_Window* focused = SDL_GetKeyboardFocus() ; focused != nullptr)
+    {
+        if(WindowQueue* queue = findQueue(SDL_GetWindowID(focused)) ; queue != nullptr)
+            return queue;
+    }
+
+    return &m_queues.front();
+}
+
+void EventRouter::push(WindowQueue& queue, const SDL_Event& event)
+{
+    if(queue.count == queue.events.size())
+    {
+        // unroll the ring buffer into a buffer twice as big
+        std::vector<SDL_Event> events(queue.events.size() * 2);
+        for(size_t i = 0 ; i < queue.count ; ++i)
+            events[i] = queue.events[(queue.head + i) & (queue.events.size() - 1)];
+
+        queue.events = std::move(events);
+        queue.head = 0;
+    }
+
+    queue.events[(queue.head + queue.count) & (queue.events.size() - 1)] = event;
+    queue.count++;
+}
+
+bool EventRouter::coalesce(WindowQueue& queue, const SDL_Event& event)
+{
+    if(queue.count == 0)
+        return false;
+
+    SDL_Event& last = queue.events[(queue.head + queue.count - 1) & (queue.events.size() - 1)];
+    if(last.type != event.type)
+        return false;
+
+    if(event.type == SDL_MOUSEMOTION && queue.coalescing.m_mouseMotion)
+    {
+        // a change of the buttons state must stay visible
+        if(last.motion.which != event.motion.which || last.motion.state != event.motion.state)
+            return false;
+
+        const int xrel = last.motion.xrel + event.motion.xrel;
+        const int yrel = last.motion.yrel + event.motion.yrel;
+        last.motion = event.motion;
+        last.motion.xrel = xrel;
+        last.motion.yrel = yrel;
+
+        return true;
+    }
+
+    if(event.type == SDL_MOUSEWHEEL && queue.coalescing.m_mouseWheel)
+    {
+        if(last.wheel.which != event.wheel.which || last.wheel.direction != event.wheel.direction)
+            return false;
+
+        last.wheel.timestamp = event.wheel.timestamp;
+        last.wheel.x += event.wheel.x;
+        last.wheel.y += event.wheel.y;
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+        last.wheel.preciseX += event.wheel.preciseX;
+        last.wheel.preciseY += event.wheel.preciseY;
+#endif
+
+        return true;
+    }
+
+    if(event.type == SDL_WINDOWEVENT && queue.coalescing.m_windowSize)
+    {
+        if(last.window.event != event.window.event ||
+           (event.window.event != SDL_WINDOWEVENT_RESIZED && event.window.event != SDL_WINDOWEVENT_SIZE_CHANGED))
+            return false;
+
+        last.window = event.window;
+
+        return true;
+    }
+
+    return false;
+}
+
+bool EventRouter::pop(WindowQueue& queue, SDL_Event& event)
+{
+    if(queue.count == 0)
+        return false;
+
+    event = queue.events[queue.head];
+    queue.head = (queue.head + 1) & (queue.events.size() - 1);
+    queue.count--;
+
+    return true;
+}
+
+bool EventRouter::isGlobal(const SDL_Event& event)
+{
+    switch(event.type)
+    {
+        case SDL_QUIT:
+        case SDL_APP_TERMINATING:
+        case SDL_APP_LOWMEMORY:
+        case SDL_APP_WILLENTERBACKGROUND:
+        case SDL_APP_DIDENTERBACKGROUND:
+        case SDL_APP_WILLENTERFOREGROUND:
+        case SDL_APP_DIDENTERFOREGROUND:
+        case SDL_RENDER_TARGETS_RESET:
+        case SDL_RENDER_DEVICE_RESET:
+            return true;
+        default:
+            return false;
+    }
+}
+
+uint32_t EventRouter::getTargetWindow(const SDL_Event& event)
+{
+    switch(event.type)
+    {
+        case SDL_WINDOWEVENT:
+            return event.window.windowID;
+        case SDL_KEYDOWN:
+        case SDL_KEYUP:
+            return event.key.windowID;
+        case SDL_TEXTEDITING:
+            return event.edit.windowID;
+        case SDL_TEXTINPUT:
+            return event.text.windowID;
+        case SDL_MOUSEMOTION:
+            return event.motion.windowID;
+        case SDL_MOUSEBUTTONDOWN:
+        case SDL_MOUSEBUTTONUP:
+            return event.button.windowID;
+        case SDL_MOUSEWHEEL:
+            return event.wheel.windowID;
+        default:
+            // user events have a window identifier too, but it is often left uninitialized
+            return 0;
+    }
+}
+}
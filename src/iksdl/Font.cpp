@@ -22,6 +22,7 @@
 
 #include "iksdl/Font.hpp"
 #include "iksdl/InvalidParameterException.hpp"
+#include "iksdl/Initializer.hpp"
 #include <SDL_ttf.h>
 #include <SDL.h>
 #include <utility>
@@ -31,18 +32,25 @@ namespace iksdl
 Font::Font(const std::string& filePath, int ptSize) :
     m_font(nullptr)
 {
+    priv::Initializer* initializer = priv::Initializer::getInstance();
+    initializer->acquire(Subsystems::Type::Fonts);
+
     m_font = TTF_OpenFont(filePath.c_str(), ptSize);
     if(m_font == nullptr)
-        throw InvalidParameterException("Unable to load font at path " + filePath + ". Cause: " + TTF_GetError());
+    {
+        const std::string error = TTF_GetError();
+        initializer->release(Subsystems::Type::Fonts);
+        throw InvalidParameterException("Unable to load font at path " + filePath + ". Cause: " + error);
+    }
 }
 
 Font::Font(Font&& other) :
-    m_font(std::exchange(m_font, other.m_font))
+    m_font(std::exchange(other.m_font, nullptr))
 {}
 
 Font::~Font()
 {
-    TTF_CloseFont(m_font);
+    close();
 }
 
 Font& Font::operator=(Font&& other)
@@ -50,9 +58,19 @@ Font& Font::operator=(Font&& other)
     if(this == &other)
         return *this;
 
-    TTF_CloseFont(m_font);
-    m_font = std::exchange(m_font, other.m_font);
+    close();
+    m_font = std::exchange(other.m_font, nullptr);
 
     return *this;
 }
+
+void Font::close()
+{
+    // A moved font does not use SDL_ttf anymore
+    if(m_font == nullptr)
+        return;
+
+    TTF_CloseFont(m_font);
+    priv::Initializer::getInstance()->release(Subsystems::Type::Fonts);
+}
 }
@@ -0,0 +1,131 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/GameLoop.hpp"
+#include "iksdl/InvalidParameterException.hpp"
+#include <SDL.h>
+#include <thread>
+
+namespace iksdl
+{
+GameLoop::GameLoop(const GameLoopOptions& options) :
+    m_options(options), m_running(false), m_frequency(SDL_GetPerformanceFrequency()),
+    m_stepTicks(toTicks(options.m_timeStep)),
+    m_frameTicks(options.m_frameRateLimit > 0 ? m_frequency / options.m_frameRateLimit : 0),
+    m_spinTicks(toTicks(options.m_spinDuration)), m_frameStart(0), m_deadline(0),
+    m_accumulator(0), m_frameMissed(false), m_frameCount(0), m_missedFrameCount(0),
+    m_lastFrameDuration(0)
+{
+    if(m_stepTicks == 0)
+        throw InvalidParameterException("The time step of a game loop must be positive");
+
+    if(m_options.m_maxStepsPerFrame == 0)
+        throw InvalidParameterException("A game loop must allow at least one step per frame");
+}
+
+void GameLoop::start()
+{
+    m_running.store(true, std::memory_order_relaxed);
+    m_frameStart = SDL_GetPerformanceCounter();
+    m_deadline = m_frameStart + m_frameTicks;
+    m_accumulator = 0;
+    m_frameMissed = false;
+    m_frameCount = 0;
+    m_missedFrameCount = 0;
+    m_lastFrameDuration = std::chrono::nanoseconds(0);
+}
+
+unsigned int GameLoop::beginFrame()
+{
+    const uint64_t now = SDL_GetPerformanceCounter();
+    m_accumulator += now - m_frameStart;
+    m_lastFrameDuration = toNanoseconds(now - m_frameStart);
+    m_frameStart = now;
+    m_frameMissed = false;
+
+    uint64_t steps = m_accumulator / m_stepTicks;
+    if(steps > m_options.m_maxStepsPerFrame)
+    {
+        // the simulation cannot catch up, drop the late time but keep the phase for interpolation
+        steps = m_options.m_maxStepsPerFrame;
+        m_accumulator %= m_stepTicks;
+        m_frameMissed = true;
+        m_missedFrameCount++;
+    }
+    else
+    {
+        m_accumulator -= steps * m_stepTicks;
+    }
+
+    return static_cast<unsigned int>(steps);
+}
+
+void GameLoop::endFrame()
+{
+    m_frameCount++;
+
+    if(m_frameTicks == 0)
+        return;
+
+    uint64_t now = SDL_GetPerformanceCounter();
+    if(now >= m_deadline)
+    {
+        // the frame is late, restart the pacing from now rather than trying to catch up
+        if(!m_frameMissed)
+            m_missedFrameCount++;
+
+        m_deadline = now + m_frameTicks;
+        return;
+    }
+
+    // sleep for most of the remaining time, the scheduler is not precise enough for the rest
+    const uint64_t remaining = m_deadline - now;
+    if(remaining > m_spinTicks)
+    {
+        const uint64_t sleepMilliseconds = (remaining - m_spinTicks) * 1000 / m_frequency;
+        if(sleepMilliseconds > 0)
+            SDL_Delay(static_cast<Uint32>(sleepMilliseconds));
+    }
+
+    while(SDL_GetPerformanceCounter() < m_deadline)
+        std::this_thread::yield();
+
+    // advance from the previous deadline so that the frame rate does not drift
+    m_deadline += m_frameTicks;
+}
+
+uint64_t GameLoop::toTicks(std::chrono::nanoseconds duration) const
+{
+    if(duration.count() <= 0)
+        return 0;
+
+    const uint64_t nanoseconds = static_cast<uint64_t>(duration.count());
+    return nanoseconds / 1'000'000'000 * m_frequency + nanoseconds % 1'000'000'000 * m_frequency / 1'000'000'000;
+}
+
+std::chrono::nanoseconds GameLoop::toNanoseconds(uint64_t ticks) const
+{
+    // split the division so that long frames do not overflow
+    return std::chrono::nanoseconds(ticks / m_frequency * 1'000'000'000 + ticks % m_frequency * 1'000'000'000 / m_frequency);
+}
+
+}
@@ -0,0 +1,175 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/Initializer.hpp"
+#include "iksdl/AudioDevice.hpp"
+#include "iksdl/SdlException.hpp"
+#include <SDL_image.h>
+#include <SDL_ttf.h>
+#include <string>
+
+namespace iksdl::priv
+{
+void Initializer::acquire(Subsystems::Type type)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // A device closed explicitly while sounds still use it is reopened by the next one
+    const std::size_t index = static_cast<std::size_t>(type);
+    if(m_users[index]++ > 0 && (type != Subsystems::Type::Audio || AudioDevice::isOpen()))
+        return;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    try
+    {
+        switch(type)
+        {
+            case Subsystems::Type::Video:
+                if(SDL_InitSubSystem(SDL_INIT_VIDEO) < 0)
+                    throw SdlException(std::string(INIT_VIDEO_ERROR) + SDL_GetError());
+                break;
+
+            case Subsystems::Type::Fonts:
+                if(TTF_Init() < 0)
+                    throw SdlException(std::string(INIT_FONTS_ERROR) + TTF_GetError());
+                break;
+
+            case Subsystems::Type::Audio:
+                // A device opened by the user is kept, with its settings. A closed device has
+                // no mixing engine installed, so it can be opened from a loading thread.
+                if(!AudioDevice::isOpen())
+                {
+                    AudioDevice::openDevice();
+
+                    // Opened for the sounds, closed with the last of them
+                    m_ownsAudioDevice.store(true, std::memory_order_relaxed);
+                }
+                return;
+
+            default:
+                return;
+        }
+    }
+    catch(...)
+    {
+        --m_users[index];
+        throw;
+    }
+
+    m_initialized[index].store(true, std::memory_order_release);
+    recordDuration(type, std::chrono::steady_clock::now() - start);
+}
+
+void Initializer::release(Subsystems::Type type)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const std::size_t index = static_cast<std::size_t>(type);
+    if(m_users[index] == 0 || --m_users[index] > 0)
+        return;
+
+    switch(type)
+    {
+        case Subsystems::Type::Video:
+            // The codecs are only used by the textures, which need a window
+            if(isInitialized(Subsystems::Type::PngCodec) || isInitialized(Subsystems::Type::JpgCodec) ||
+               isInitialized(Subsystems::Type::TifCodec) || isInitialized(Subsystems::Type::WebpCodec))
+            {
+                IMG_Quit();
+                for(Subsystems::Type codec : {Subsystems::Type::PngCodec, Subsystems::Type::JpgCodec,
+                                              Subsystems::Type::TifCodec, Subsystems::Type::WebpCodec})
+                    m_initialized[static_cast<std::size_t>(codec)].store(false, std::memory_order_release);
+            }
+
+            SDL_QuitSubSystem(SDL_INIT_VIDEO);
+            break;
+
+        case Subsystems::Type::Fonts:
+            TTF_Quit();
+            break;
+
+        case Subsystems::Type::Audio:
+            if(m_ownsAudioDevice.exchange(false, std::memory_order_relaxed))
+                AudioDevice::close();
+            return;
+
+        default:
+            return;
+    }
+
+    m_initialized[index].store(false, std::memory_order_release);
+}
+
+void Initializer::prepareCodec(SDL_RWops* stream)
+{
+    // BMP, GIF, TGA and the other formats are decoded by SDL_image without codec library
+    if(IMG_isPNG(stream))
+        initCodec(Subsystems::Type::PngCodec, IMG_INIT_PNG);
+    else if(IMG_isJPG(stream))
+        initCodec(Subsystems::Type::JpgCodec, IMG_INIT_JPG);
+    else if(IMG_isTIF(stream))
+        initCodec(Subsystems::Type::TifCodec, IMG_INIT_TIF);
+    else if(IMG_isWEBP(stream))
+        initCodec(Subsystems::Type::WebpCodec, IMG_INIT_WEBP);
+}
+
+void Initializer::recordDuration(Subsystems::Type type, std::chrono::nanoseconds duration)
+{
+    m_durations[static_cast<std::size_t>(type)].store(duration.count(), std::memory_order_relaxed);
+}
+
+void Initializer::disownAudioDevice()
+{
+    m_ownsAudioDevice.store(false, std::memory_order_relaxed);
+}
+
+bool Initializer::isInitialized(Subsystems::Type type) const
+{
+    if(type == Subsystems::Type::Audio)
+        return AudioDevice::isOpen();
+
+    return m_initialized[static_cast<std::size_t>(type)].load(std::memory_order_acquire);
+}
+
+std::chrono::nanoseconds Initializer::getDuration(Subsystems::Type type) const
+{
+    return std::chrono::nanoseconds(m_durations[static_cast<std::size_t>(type)].load(std::memory_order_relaxed));
+}
+
+void Initializer::initCodec(Subsystems::Type type, int flags)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const std::size_t index = static_cast<std::size_t>(type);
+    if(m_initialized[index].load(std::memory_order_relaxed))
+        return;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    if(!(IMG_Init(flags) & flags))
+        throw SdlException(std::string(INIT_CODEC_ERROR) + IMG_GetError());
+
+    m_initialized[index].store(true, std::memory_order_release);
+    recordDuration(type, std::chrono::steady_clock::now() - start);
+}
+}
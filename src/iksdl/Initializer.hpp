@@ -0,0 +1,155 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_INITIALIZER_HPP
+#define IKSDL_INITIALIZER_HPP
+
+#include "iksdl/Subsystems.hpp"
+#include <SDL.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+
+namespace iksdl::priv
+{
+
+/////////////////////////////////////////////////
+/// \brief Reference counted initialization of the SDL subsystems
+///
+/// Each object needing a subsystem acquires it when it is created
+/// and releases it when it is destroyed. The subsystem is
+/// initialized by the first acquisition and shut down by the
+/// last release.
+///
+/// The methods can be called from any thread, so that the
+/// resources can be loaded in the background.
+///
+/// \warning This is IKSDL internal code that should not be
+/// used outside of the library
+/////////////////////////////////////////////////
+class Initializer
+{
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Get the singleton instance
+        ///
+        /// \return Singleton instance
+        /////////////////////////////////////////////////
+        inline static Initializer* getInstance() { static Initializer initializer; return &initializer; }
+
+        /////////////////////////////////////////////////
+        /// \brief Initialize a subsystem if it is its first user
+        ///
+        /// This method will throw \a SdlException if the
+        /// subsystem could not be initialized.
+        ///
+        /// \param type Video, Audio or Fonts
+        /////////////////////////////////////////////////
+        void acquire(Subsystems::Type type);
+
+        /////////////////////////////////////////////////
+        /// \brief Shut a subsystem down if it was its last user
+        ///
+        /// \param type Video, Audio or Fonts
+        /////////////////////////////////////////////////
+        void release(Subsystems::Type type);
+
+        /////////////////////////////////////////////////
+        /// \brief Initialize the codec able to decode an image
+        ///
+        /// The format is recognized from the first bytes of the
+        /// image, the stream is left at its current position.
+        /// Nothing is done for the formats built in SDL_image.
+        ///
+        /// This method will throw \a SdlException if the
+        /// codec could not be initialized.
+        ///
+        /// \param stream Image to decode
+        /////////////////////////////////////////////////
+        void prepareCodec(SDL_RWops* stream);
+
+        /////////////////////////////////////////////////
+        /// \brief Save the time spent initializing a subsystem
+        ///
+        /// \param type     Initialized subsystem
+        /// \param duration Time spent in the initialization
+        /////////////////////////////////////////////////
+        void recordDuration(Subsystems::Type type, std::chrono::nanoseconds duration);
+
+        /////////////////////////////////////////////////
+        /// \brief Keep the audio device opened after the last sound or music
+        ///
+        /// Called when the user opens the device, which must then
+        /// stay opened until the user closes it.
+        /////////////////////////////////////////////////
+        void disownAudioDevice();
+
+        /////////////////////////////////////////////////
+        /// \brief Is a subsystem currently initialized?
+        ///
+        /// \param type Subsystem to check
+        ///
+        /// \return True if the subsystem is initialized
+        /////////////////////////////////////////////////
+        bool isInitialized(Subsystems::Type type) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Get the time spent initializing a subsystem
+        ///
+        /// \param type Subsystem to check
+        ///
+        /// \return Duration of the last initialization
+        /////////////////////////////////////////////////
+        std::chrono::nanoseconds getDuration(Subsystems::Type type) const;
+
+    private:
+
+        static constexpr std::size_t TYPES_COUNT = 7; ///< Number of subsystem types
+
+        static constexpr std::string_view INIT_VIDEO_ERROR = "Could not create SDL context.\nCause: ";
+        static constexpr std::string_view INIT_CODEC_ERROR = "Could not load image loader.\nCause: ";
+        static constexpr std::string_view INIT_FONTS_ERROR = "Could not load font loaders.\nCause: ";
+
+        Initializer() = default;
+
+        /////////////////////////////////////////////////
+        /// \brief Initialize an image codec, if not done yet
+        ///
+        /// \param type  Codec subsystem
+        /// \param flags SDL_image flag of the codec
+        /////////////////////////////////////////////////
+        void initCodec(Subsystems::Type type, int flags);
+
+        std::mutex m_mutex;                                          ///< Protects the users counts
+        std::array<unsigned int, TYPES_COUNT> m_users{};             ///< Number of users of each subsystem
+        std::array<std::atomic<bool>, TYPES_COUNT> m_initialized{};  ///< Is each subsystem initialized?
+        std::array<std::atomic<int64_t>, TYPES_COUNT> m_durations{}; ///< Last initialization duration of each subsystem, in nanoseconds
+        std::atomic<bool> m_ownsAudioDevice{false};                  ///< Was the audio device opened by the first sound?
+};
+
+}
+
+#endif // IKSDL_INITIALIZER_HPP
@@ -0,0 +1,53 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/InputState.hpp"
+#include "iksdl/KeyTables.hpp"
+#include <SDL.h>
+
+namespace iksdl
+{
+InputState::InputState() :
+    m_mousePosition(0, 0),
+    m_previousMousePosition(0, 0)
+{}
+
+void InputState::update()
+{
+    m_previousKeys = m_keys;
+    m_previousButtons = m_buttons;
+    m_previousMousePosition = m_mousePosition;
+
+    // Process the system events once for all the queries of the frame
+    SDL_PumpEvents();
+
+    const uint8_t* keyboardState = SDL_GetKeyboardState(nullptr);
+    for(size_t i = 0 ; i < Keyboard::KEY_COUNT ; ++i)
+        m_keys[i] = keyboardState[priv::KEY_SCANCODES[i]] != 0;
+
+    // SDL button masks follow the order of Mouse::Button
+    int x = 0, y = 0;
+    const uint32_t mouseState = SDL_GetMouseState(&x, &y);
+    m_buttons = std::bitset<Mouse::BUTTON_COUNT>(mouseState);
+    m_mousePosition = Positioni(x, y);
+}
+}
@@ -0,0 +1,102 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/JobSystem.hpp"
+#include "iksdl/Jobs.hpp"
+
+namespace iksdl
+{
+void JobSystem::start(const JobSystemOptions& options)
+{
+    priv::Jobs::getInstance()->start(options.m_workers, options.m_pinToCores);
+}
+
+void JobSystem::stop()
+{
+    priv::Jobs::getInstance()->stop();
+}
+
+bool JobSystem::isRunning()
+{
+    return priv::Jobs::getInstance()->isRunning();
+}
+
+Job JobSystem::schedule(std::function<void()> task)
+{
+    return Job(priv::Jobs::getInstance()->schedule(std::move(task)));
+}
+
+Job JobSystem::schedule(std::function<void()> task, const std::vector<Job>& dependencies)
+{
+    std::vector<std::shared_ptr<priv::JobState>> states;
+    states.reserve(dependencies.size());
+
+    for(const Job& dependency : dependencies)
+    {
+        if(dependency.m_state != nullptr)
+            states.push_back(dependency.m_state);
+    }
+
+    return Job(priv::Jobs::getInstance()->schedule(std::move(task), states));
+}
+
+void JobSystem::wait(const Job& job)
+{
+    if(job.m_state == nullptr)
+        return;
+
+    priv::Jobs::getInstance()->wait(*job.m_state);
+
+    if(job.m_state->error)
+        std::rethrow_exception(job.m_state->error);
+}
+
+void JobSystem::parallelFor(size_t begin, size_t end, const std::function<void(size_t, size_t)>& body, size_t grain)
+{
+    priv::Jobs::getInstance()->parallelFor(begin, end, body, grain);
+}
+
+unsigned int JobSystem::getWorkersCount()
+{
+    return priv::Jobs::getInstance()->getWorkersCount();
+}
+
+size_t JobSystem::getQueueDepth()
+{
+    return priv::Jobs::getInstance()->getQueueDepth();
+}
+
+uint64_t JobSystem::getStealsCount()
+{
+    return priv::Jobs::getInstance()->getStealsCount();
+}
+
+uint64_t JobSystem::getExecutedCount()
+{
+    return priv::Jobs::getInstance()->getExecutedCount();
+}
+
+void JobSystem::resetStatistics()
+{
+    priv::Jobs::getInstance()->resetStatistics();
+}
+}
@@ -0,0 +1,398 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/Jobs.hpp"
+#include <algorithm>
+
+#if defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+#elif defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#endif
+
+namespace iksdl::priv
+{
+namespace
+{
+/////////////////////////////////////////////////
+/// \brief Index of the worker running on this thread, -1 for the other threads
+/////////////////////////////////////////////////
+thread_local int currentWorker = -1;
+
+/////////////////////////////////////////////////
+/// \brief Number of jobs running on this thread, they keep the workers alive
+/////////////////////////////////////////////////
+thread_local unsigned int runningJobs = 0;
+
+/////////////////////////////////////////////////
+/// \brief Run a thread only on one CPU core, if supported by the platform
+/////////////////////////////////////////////////
+void pin(std::thread& thread, unsigned int core)
+{
+#if defined(__linux__)
+    cpu_set_t cores;
+    CPU_ZERO(&cores);
+    CPU_SET(core % CPU_SETSIZE, &cores);
+    pthread_setaffinity_np(thread.native_handle(), sizeof(cores), &cores);
+#elif defined(_WIN32)
+    SetThreadAffinityMask(thread.native_handle(), static_cast<DWORD_PTR>(1) << (core % (sizeof(DWORD_PTR) * 8)));
+#else
+    (void) thread;
+    (void) core;
+#endif
+}
+}
+
+Jobs::~Jobs()
+{
+    stop();
+}
+
+void Jobs::start(unsigned int workers, bool pinToCores)
+{
+    stop();
+
+    const std::lock_guard<std::mutex> lock(m_startMutex);
+    if(!m_running.load(std::memory_order_acquire))
+        launch(workers, pinToCores);
+}
+
+void Jobs::stop()
+{
+    const std::lock_guard<std::mutex> lock(m_startMutex);
+    if(!m_running.load(std::memory_order_acquire))
+        return;
+
+    // The other threads cannot schedule jobs anymore, except the running jobs.
+    // The scheduled jobs may be waited for, they must run
+    const std::lock_guard<std::shared_mutex> workersLock(m_workersMutex);
+    while(m_unfinished.load(std::memory_order_acquire) > 0)
+    {
+        std::shared_ptr<JobState> job = take(currentWorker);
+        if(job != nullptr)
+            execute(std::move(job));
+        else
+            std::this_thread::yield();
+    }
+
+    {
+        const std::lock_guard<std::mutex> sleepLock(m_sleepMutex);
+        m_stopping = true;
+    }
+    m_sleepCondition.notify_all();
+
+    for(std::unique_ptr<Worker>& worker : m_workers)
+        worker->thread.join();
+
+    m_running.store(false, std::memory_order_release);
+    m_workersCount.store(0, std::memory_order_release);
+    m_workers.clear();
+}
+
+std::shared_ptr<JobState> Jobs::schedule(std::function<void()>&& task,
+                                         const std::vector<std::shared_ptr<JobState>>& dependencies)
+{
+    const std::shared_lock<std::shared_mutex> lock = lockWorkers();
+
+    std::shared_ptr<JobState> job = create(std::move(task));
+
+    for(const std::shared_ptr<JobState>& dependency : dependencies)
+    {
+        const std::lock_guard<std::mutex> lock(dependency->mutex);
+        if(!dependency->finished.load(std::memory_order_relaxed))
+        {
+            job->blockers.fetch_add(1, std::memory_order_relaxed);
+            dependency->continuations.push_back(job);
+        }
+    }
+
+    // The job may have been started by its last dependency already
+    if(job->blockers.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        enqueue(std::shared_ptr<JobState>(job));
+
+    return job;
+}
+
+void Jobs::wait(const JobState& job)
+{
+    while(!job.finished.load(std::memory_order_acquire))
+    {
+        if(!runOne(currentWorker))
+            std::this_thread::yield();
+    }
+}
+
+void Jobs::parallelFor(size_t begin, size_t end, const std::function<void(size_t, size_t)>& body, size_t grain)
+{
+    if(begin >= end)
+        return;
+
+    ensureStarted();
+
+    const std::shared_ptr<Loop> loop = std::make_shared<Loop>(body, std::max<size_t>(grain, 1), end - begin);
+    split(loop, begin, end);
+
+    while(loop->remaining.load(std::memory_order_acquire) > 0)
+    {
+        if(!runOne(currentWorker))
+            std::this_thread::yield();
+    }
+
+    if(loop->error)
+        std::rethrow_exception(loop->error);
+}
+
+void Jobs::resetStatistics()
+{
+    m_steals.store(0, std::memory_order_relaxed);
+    m_executed.store(0, std::memory_order_relaxed);
+}
+
+void Jobs::ensureStarted()
+{
+    if(m_running.load(std::memory_order_acquire))
+        return;
+
+    const std::lock_guard<std::mutex> lock(m_startMutex);
+    if(!m_running.load(std::memory_order_acquire))
+        launch(0, false);
+}
+
+std::shared_lock<std::shared_mutex> Jobs::lockWorkers()
+{
+    // The workers are stopped once all the jobs ran, so a running job keeps them alive
+    if(currentWorker >= 0 || runningJobs > 0)
+        return std::shared_lock<std::shared_mutex>();
+
+    while(true)
+    {
+        ensureStarted();
+
+        // The workers may have been stopped meanwhile
+        std::shared_lock<std::shared_mutex> lock(m_workersMutex);
+        if(m_running.load(std::memory_order_acquire))
+            return lock;
+    }
+}
+
+void Jobs::launch(unsigned int workers, bool pinToCores)
+{
+    const unsigned int cores = std::max(std::thread::hardware_concurrency(), 1u);
+    const unsigned int count = workers > 0 ? workers : std::max(cores - 1, 1u);
+
+    {
+        const std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_stopping = false;
+    }
+
+    // All the queues must exist before a worker tries to steal from them
+    const std::lock_guard<std::shared_mutex> workersLock(m_workersMutex);
+    for(unsigned int i = 0 ; i < count ; ++i)
+        m_workers.push_back(std::make_unique<Worker>());
+    m_workersCount.store(count, std::memory_order_release);
+
+    for(unsigned int i = 0 ; i < count ; ++i)
+    {
+        m_workers[i]->thread = std::thread(&Jobs::work, this, static_cast<int>(i));
+
+        // The first core is left to the main thread
+        if(pinToCores)
+            pin(m_workers[i]->thread, (i + 1) % cores);
+    }
+
+    m_running.store(true, std::memory_order_release);
+}
+
+std::shared_ptr<JobState> Jobs::create(std::function<void()>&& task)
+{
+    std::shared_ptr<JobState> job = std::make_shared<JobState>();
+    job->task = std::move(task);
+
+    m_unfinished.fetch_add(1, std::memory_order_relaxed);
+    return job;
+}
+
+void Jobs::enqueue(std::shared_ptr<JobState>&& job)
+{
+    // The jobs scheduled by a job stay on its worker, the other ones are spread
+    const unsigned int count = m_workersCount.load(std::memory_order_acquire);
+    const unsigned int index = currentWorker >= 0 ? static_cast<unsigned int>(currentWorker)
+                                                  : m_nextWorker.fetch_add(1, std::memory_order_relaxed) % count;
+
+    {
+        Worker& worker = *m_workers[index];
+        const std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.jobs.push_back(std::move(job));
+    }
+
+    m_queued.fetch_add(1);
+
+    if(m_sleeping.load() > 0)
+    {
+        { const std::lock_guard<std::mutex> lock(m_sleepMutex); }
+        m_sleepCondition.notify_one();
+    }
+}
+
+bool Jobs::runOne(int worker)
+{
+    std::shared_ptr<JobState> job;
+    if(worker >= 0 || runningJobs > 0)
+        job = take(worker);
+    else
+    {
+        const std::shared_lock<std::shared_mutex> lock(m_workersMutex);
+        job = take(worker);
+    }
+
+    if(job == nullptr)
+        return false;
+
+    execute(std::move(job));
+    return true;
+}
+
+std::shared_ptr<JobState> Jobs::take(int worker)
+{
+    std::shared_ptr<JobState> job;
+
+    // The own queue is used as a stack, the last pushed job is the most likely to be in cache
+    if(worker >= 0)
+    {
+        Worker& own = *m_workers[worker];
+        const std::lock_guard<std::mutex> lock(own.mutex);
+        if(!own.jobs.empty())
+        {
+            job = std::move(own.jobs.back());
+            own.jobs.pop_back();
+        }
+    }
+
+    if(job == nullptr)
+    {
+        const unsigned int count = m_workersCount.load(std::memory_order_acquire);
+        const unsigned int first = worker >= 0 ? static_cast<unsigned int>(worker) + 1 : m_nextWorker.load(std::memory_order_relaxed);
+
+        for(unsigned int i = 0 ; i < count && job == nullptr ; ++i)
+        {
+            const unsigned int victim = (first + i) % count;
+            if(static_cast<int>(victim) == worker)
+                continue;
+
+            Worker& other = *m_workers[victim];
+            const std::lock_guard<std::mutex> lock(other.mutex);
+            if(!other.jobs.empty())
+            {
+                job = std::move(other.jobs.front());
+                other.jobs.pop_front();
+                m_steals.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    if(job != nullptr)
+        m_queued.fetch_sub(1, std::memory_order_relaxed);
+
+    return job;
+}
+
+void Jobs::execute(std::shared_ptr<JobState>&& job)
+{
+    ++runningJobs;
+    try
+    {
+        job->task();
+    }
+    catch(...)
+    {
+        job->error = std::current_exception();
+    }
+    --runningJobs;
+
+    // Release what the task captured as soon as possible
+    job->task = nullptr;
+    m_executed.fetch_add(1, std::memory_order_relaxed);
+
+    std::vector<std::shared_ptr<JobState>> continuations;
+    {
+        const std::lock_guard<std::mutex> lock(job->mutex);
+        job->finished.store(true, std::memory_order_release);
+        continuations.swap(job->continuations);
+    }
+
+    for(std::shared_ptr<JobState>& continuation : continuations)
+    {
+        if(continuation->blockers.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            enqueue(std::move(continuation));
+    }
+
+    m_unfinished.fetch_sub(1, std::memory_order_release);
+}
+
+void Jobs::split(const std::shared_ptr<Loop>& loop, size_t first, size_t last)
+{
+    // The second halves are pushed from the largest to the smallest, the thieves take the largest ones
+    while(last - first > loop->grain)
+    {
+        const size_t middle = first + (last - first) / 2;
+        const std::shared_lock<std::shared_mutex> lock = lockWorkers();
+        enqueue(create([this, loop, middle, last]() { split(loop, middle, last); }));
+        last = middle;
+    }
+
+    try
+    {
+        loop->body(first, last);
+    }
+    catch(...)
+    {
+        const std::lock_guard<std::mutex> lock(loop->errorMutex);
+        if(!loop->error)
+            loop->error = std::current_exception();
+    }
+
+    loop->remaining.fetch_sub(last - first, std::memory_order_acq_rel);
+}
+
+void Jobs::work(int index)
+{
+    currentWorker = index;
+
+    while(true)
+    {
+        if(runOne(index))
+            continue;
+
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_sleeping.fetch_add(1);
+        m_sleepCondition.wait(lock, [this]() { return m_stopping || m_queued.load() > 0; });
+        m_sleeping.fetch_sub(1);
+
+        if(m_stopping)
+            return;
+    }
+}
+}
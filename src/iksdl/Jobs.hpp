@@ -0,0 +1,308 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_JOBS_HPP
+#define IKSDL_JOBS_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+namespace iksdl::priv
+{
+
+/////////////////////////////////////////////////
+/// \brief State of a scheduled job
+///
+/// \warning This is IKSDL internal code that should not be
+/// used outside of the library
+/////////////////////////////////////////////////
+struct JobState
+{
+    std::function<void()> task;                           ///< Function to run
+    std::atomic<int> blockers{1};                         ///< Unfinished dependencies, plus one until the job is scheduled
+    std::mutex mutex;                                     ///< Protects the continuations and the end of the job
+    std::vector<std::shared_ptr<JobState>> continuations; ///< Jobs waiting for this one
+    std::atomic<bool> finished{false};                    ///< Has the job run?
+    std::exception_ptr error;                             ///< Exception thrown by the job
+};
+
+/////////////////////////////////////////////////
+/// \brief Pool of worker threads with work stealing
+///
+/// Each worker owns a queue: it takes the last pushed job of its
+/// queue, while the other threads steal the first one, which
+/// is usually the largest part of a split work.
+///
+/// The jobs can be scheduled from any thread. The system must be
+/// started and stopped from the main thread, the jobs scheduled
+/// by the other threads while it stops start it again afterwards.
+///
+/// \warning This is IKSDL internal code that should not be
+/// used outside of the library
+/////////////////////////////////////////////////
+class Jobs
+{
+    public:
+
+        /////////////////////////////////////////////////
+        /// \brief Get the singleton instance
+        ///
+        /// \return Singleton instance
+        /////////////////////////////////////////////////
+        inline static Jobs* getInstance() { static Jobs jobs; return &jobs; }
+
+        /////////////////////////////////////////////////
+        /// \brief Destructor, stops the workers
+        /////////////////////////////////////////////////
+        ~Jobs();
+
+        /////////////////////////////////////////////////
+        /// \brief Start the workers, stopping the previous ones
+        ///
+        /// \param workers    Number of workers, 0 for one per core except one
+        /// \param pinToCores Should each worker run on its own core?
+        /////////////////////////////////////////////////
+        void start(unsigned int workers, bool pinToCores);
+
+        /////////////////////////////////////////////////
+        /// \brief Run all the scheduled jobs, then stop the workers
+        /////////////////////////////////////////////////
+        void stop();
+
+        /////////////////////////////////////////////////
+        /// \brief Are the workers running?
+        ///
+        /// \return True if the system is started
+        /////////////////////////////////////////////////
+        inline bool isRunning() const { return m_running.load(std::memory_order_acquire); }
+
+        /////////////////////////////////////////////////
+        /// \brief Schedule a job, starting the workers if needed
+        ///
+        /// \param task         Function to run
+        /// \param dependencies Jobs that must finish before this one starts
+        ///
+        /// \return State of the job
+        /////////////////////////////////////////////////
+        std::shared_ptr<JobState> schedule(std::function<void()>&& task,
+                                           const std::vector<std::shared_ptr<JobState>>& dependencies = {});
+
+        /////////////////////////////////////////////////
+        /// \brief Wait for a job, running other jobs meanwhile
+        ///
+        /// \param job Job to wait for
+        /////////////////////////////////////////////////
+        void wait(const JobState& job);
+
+        /////////////////////////////////////////////////
+        /// \brief Run a function over a range, split between the threads
+        ///
+        /// \param begin First index
+        /// \param end   Index after the last one
+        /// \param body  Function processing a part of the range
+        /// \param grain Maximum size of a part
+        /////////////////////////////////////////////////
+        void parallelFor(size_t begin, size_t end, const std::function<void(size_t, size_t)>& body, size_t grain);
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of workers
+        ///
+        /// \return Number of workers
+        /////////////////////////////////////////////////
+        inline unsigned int getWorkersCount() const { return m_workersCount.load(std::memory_order_acquire); }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of jobs waiting in the queues
+        ///
+        /// \return Number of queued jobs
+        /////////////////////////////////////////////////
+        inline size_t getQueueDepth() const { return m_queued.load(std::memory_order_relaxed); }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of stolen jobs
+        ///
+        /// \return Number of steals
+        /////////////////////////////////////////////////
+        inline uint64_t getStealsCount() const { return m_steals.load(std::memory_order_relaxed); }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the number of run jobs
+        ///
+        /// \return Number of run jobs
+        /////////////////////////////////////////////////
+        inline uint64_t getExecutedCount() const { return m_executed.load(std::memory_order_relaxed); }
+
+        /////////////////////////////////////////////////
+        /// \brief Reset the numbers of steals and run jobs
+        /////////////////////////////////////////////////
+        void resetStatistics();
+
+    private:
+
+        /////////////////////////////////////////////////
+        /// \brief Worker thread and its queue
+        /////////////////////////////////////////////////
+        struct Worker
+        {
+            std::deque<std::shared_ptr<JobState>> jobs; ///< Jobs ready to run
+            std::mutex mutex;                           ///< Protects the jobs
+            std::thread thread;                         ///< Thread running the jobs
+        };
+
+        /////////////////////////////////////////////////
+        /// \brief Range of a parallel loop
+        /////////////////////////////////////////////////
+        struct Loop
+        {
+            /////////////////////////////////////////////////
+            /// \brief Constructor
+            ///
+            /// \param body  Function processing a part of the range
+            /// \param grain Maximum size of a part
+            /// \param count Number of indices of the range
+            /////////////////////////////////////////////////
+            Loop(const std::function<void(size_t, size_t)>& body, size_t grain, size_t count) :
+                body(body),
+                grain(grain),
+                remaining(count)
+            {}
+
+            const std::function<void(size_t, size_t)>& body; ///< Function processing a part of the range
+            size_t grain;                                    ///< Maximum size of a part
+            std::atomic<size_t> remaining;                   ///< Number of indices not processed yet
+            std::mutex errorMutex;                           ///< Protects the error
+            std::exception_ptr error;                        ///< First exception thrown by the function
+        };
+
+        Jobs() = default;
+
+        /////////////////////////////////////////////////
+        /// \brief Start the workers with the default options if they are not running
+        /////////////////////////////////////////////////
+        void ensureStarted();
+
+        /////////////////////////////////////////////////
+        /// \brief Prevent the workers from being stopped while the calling thread uses their queues
+        ///
+        /// The workers are started if needed. Nothing is locked on a
+        /// worker or during a job, since a running job keeps them alive.
+        ///
+        /// \return Lock to keep while the queues are used
+        /////////////////////////////////////////////////
+        std::shared_lock<std::shared_mutex> lockWorkers();
+
+        /////////////////////////////////////////////////
+        /// \brief Create the workers, the start mutex must be locked
+        ///
+        /// \param workers    Number of workers, 0 for one per core except one
+        /// \param pinToCores Should each worker run on its own core?
+        /////////////////////////////////////////////////
+        void launch(unsigned int workers, bool pinToCores);
+
+        /////////////////////////////////////////////////
+        /// \brief Create the state of a job that will be counted as unfinished
+        ///
+        /// \param task Function to run
+        ///
+        /// \return State of the job
+        /////////////////////////////////////////////////
+        std::shared_ptr<JobState> create(std::function<void()>&& task);
+
+        /////////////////////////////////////////////////
+        /// \brief Put a job whose dependencies are finished in a queue
+        ///
+        /// The workers must be kept alive by the caller.
+        ///
+        /// \param job Job ready to run
+        /////////////////////////////////////////////////
+        void enqueue(std::shared_ptr<JobState>&& job);
+
+        /////////////////////////////////////////////////
+        /// \brief Run one queued job, from the own queue or stolen
+        ///
+        /// \param worker Index of the calling worker, -1 for other threads
+        ///
+        /// \return True if a job was run
+        /////////////////////////////////////////////////
+        bool runOne(int worker);
+
+        /////////////////////////////////////////////////
+        /// \brief Take a job from the own queue or steal one from another queue
+        ///
+        /// \param worker Index of the calling worker, -1 for other threads
+        ///
+        /// \return Job to run, null if all the queues are empty
+        /////////////////////////////////////////////////
+        std::shared_ptr<JobState> take(int worker);
+
+        /////////////////////////////////////////////////
+        /// \brief Run a job and schedule the jobs waiting for it
+        ///
+        /// \param job Job to run
+        /////////////////////////////////////////////////
+        void execute(std::shared_ptr<JobState>&& job);
+
+        /////////////////////////////////////////////////
+        /// \brief Process a part of a parallel loop, scheduling its second half while it is too large
+        ///
+        /// \param loop  Parallel loop
+        /// \param first First index of the part
+        /// \param last  Index after the last one of the part
+        /////////////////////////////////////////////////
+        void split(const std::shared_ptr<Loop>& loop, size_t first, size_t last);
+
+        /////////////////////////////////////////////////
+        /// \brief Run the jobs until the system is stopped
+        ///
+        /// \param index Index of the worker
+        /////////////////////////////////////////////////
+        void work(int index);
+
+        std::vector<std::unique_ptr<Worker>> m_workers; ///< Workers and their queues
+        std::atomic<unsigned int> m_workersCount{0};    ///< Number of workers
+        std::atomic<bool> m_running{false};             ///< Are the workers running?
+        std::shared_mutex m_workersMutex;               ///< Prevents stopping the workers while other threads use their queues
+        std::mutex m_startMutex;                        ///< Prevents starting the workers twice
+        std::mutex m_sleepMutex;                        ///< Protects the sleep of the workers
+        std::condition_variable m_sleepCondition;       ///< Wakes up the workers when a job is queued
+        bool m_stopping = false;                        ///< Are the workers stopping?
+        std::atomic<unsigned int> m_sleeping{0};        ///< Number of workers waiting for a job
+        std::atomic<unsigned int> m_nextWorker{0};      ///< Worker receiving the next job from another thread
+        std::atomic<size_t> m_queued{0};                ///< Number of queued jobs
+        std::atomic<size_t> m_unfinished{0};            ///< Number of scheduled jobs that have not run yet
+        std::atomic<uint64_t> m_steals{0};              ///< Number of stolen jobs
+        std::atomic<uint64_t> m_executed{0};            ///< Number of run jobs
+};
+
+}
+
+#endif // IKSDL_JOBS_HPP
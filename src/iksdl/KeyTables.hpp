@@ -0,0 +1,299 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_KEY_TABLES_HPP
+#define IKSDL_KEY_TABLES_HPP
+
+#include "iksdl/Keyboard.hpp"
+#include <SDL.h>
+#include <array>
+#include <cstdint>
+#include <optional>
+
+namespace iksdl::priv
+{
+
+/////////////////////////////////////////////////
+/// \brief Association between a key and its SDL codes
+///
+/// \warning This is IKSDL internal code that should not be
+/// used outside of the library
+/////////////////////////////////////////////////
+struct KeyCodes
+{
+    Keyboard::Key key;     ///< Key
+    SDL_Scancode scancode; ///< Physical location of the key
+    SDL_Keycode keycode;   ///< Virtual code of the key
+};
+
+/////////////////////////////////////////////////
+/// \brief SDL codes of all the keys, in the order of \a Keyboard::Key
+///
+/// \warning This is IKSDL internal code that should not be
+/// used outside of the library
+/////////////////////////////////////////////////
+inline constexpr std::array<KeyCodes, Keyboard::KEY_COUNT> KEY_CODES =
+{{
+    { Keyboard::Key::A, SDL_SCANCODE_A, SDLK_a },
+    { Keyboard::Key::B, SDL_SCANCODE_B, SDLK_b },
+    { Keyboard::Key::C, SDL_SCANCODE_C, SDLK_c },
+    { Keyboard::Key::D, SDL_SCANCODE_D, SDLK_d },
+    { Keyboard::Key::E, SDL_SCANCODE_E, SDLK_e },
+    { Keyboard::Key::F, SDL_SCANCODE_F, SDLK_f },
+    { Keyboard::Key::G, SDL_SCANCODE_G, SDLK_g },
+    { Keyboard::Key::H, SDL_SCANCODE_H, SDLK_h },
+    { Keyboard::Key::I, SDL_SCANCODE_I, SDLK_i },
+    { Keyboard::Key::J, SDL_SCANCODE_J, SDLK_j },
+    { Keyboard::Key::K, SDL_SCANCODE_K, SDLK_k },
+    { Keyboard::Key::L, SDL_SCANCODE_L, SDLK_l },
+    { Keyboard::Key::M, SDL_SCANCODE_M, SDLK_m },
+    { Keyboard::Key::N, SDL_SCANCODE_N, SDLK_n },
+    { Keyboard::Key::O, SDL_SCANCODE_O, SDLK_o },
+    { Keyboard::Key::P, SDL_SCANCODE_P, SDLK_p },
+    { Keyboard::Key::Q, SDL_SCANCODE_Q, SDLK_q },
+    { Keyboard::Key::R, SDL_SCANCODE_R, SDLK_r },
+    { Keyboard::Key::S, SDL_SCANCODE_S, SDLK_s },
+    { Keyboard::Key::T, SDL_SCANCODE_T, SDLK_t },
+    { Keyboard::Key::U, SDL_SCANCODE_U, SDLK_u },
+    { Keyboard::Key::V, SDL_SCANCODE_V, SDLK_v },
+    { Keyboard::Key::W, SDL_SCANCODE_W, SDLK_w },
+    { Keyboard::Key::X, SDL_SCANCODE_X, SDLK_x },
+    { Keyboard::Key::Y, SDL_SCANCODE_Y, SDLK_y },
+    { Keyboard::Key::Z, SDL_SCANCODE_Z, SDLK_z },
+    { Keyboard::Key::Zero, SDL_SCANCODE_0, SDLK_0 },
+    { Keyboard::Key::One, SDL_SCANCODE_1, SDLK_1 },
+    { Keyboard::Key::Two, SDL_SCANCODE_2, SDLK_2 },
+    { Keyboard::Key::Three, SDL_SCANCODE_3, SDLK_3 },
+    { Keyboard::Key::Four, SDL_SCANCODE_4, SDLK_4 },
+    { Keyboard::Key::Five, SDL_SCANCODE_5, SDLK_5 },
+    { Keyboard::Key::Six, SDL_SCANCODE_6, SDLK_6 },
+    { Keyboard::Key::Seven, SDL_SCANCODE_7, SDLK_7 },
+    { Keyboard::Key::Eight, SDL_SCANCODE_8, SDLK_8 },
+    { Keyboard::Key::Nine, SDL_SCANCODE_9, SDLK_9 },
+    { Keyboard::Key::Num0, SDL_SCANCODE_KP_0, SDLK_KP_0 },
+    { Keyboard::Key::Num1, SDL_SCANCODE_KP_1, SDLK_KP_1 },
+    { Keyboard::Key::Num2, SDL_SCANCODE_KP_2, SDLK_KP_2 },
+    { Keyboard::Key::Num3, SDL_SCANCODE_KP_3, SDLK_KP_3 },
+    { Keyboard::Key::Num4, SDL_SCANCODE_KP_4, SDLK_KP_4 },
+    { Keyboard::Key::Num5, SDL_SCANCODE_KP_5, SDLK_KP_5 },
+    { Keyboard::Key::Num6, SDL_SCANCODE_KP_6, SDLK_KP_6 },
+    { Keyboard::Key::Num7, SDL_SCANCODE_KP_7, SDLK_KP_7 },
+    { Keyboard::Key::Num8, SDL_SCANCODE_KP_8, SDLK_KP_8 },
+    { Keyboard::Key::Num9, SDL_SCANCODE_KP_9, SDLK_KP_9 },
+    { Keyboard::Key::DownArrow, SDL_SCANCODE_DOWN, SDLK_DOWN },
+    { Keyboard::Key::UpArrow, SDL_SCANCODE_UP, SDLK_UP },
+    { Keyboard::Key::LeftArrow, SDL_SCANCODE_LEFT, SDLK_LEFT },
+    { Keyboard::Key::RightArrow, SDL_SCANCODE_RIGHT, SDLK_RIGHT },
+    { Keyboard::Key::F1, SDL_SCANCODE_F1, SDLK_F1 },
+    { Keyboard::Key::F2, SDL_SCANCODE_F2, SDLK_F2 },
+    { Keyboard::Key::F3, SDL_SCANCODE_F3, SDLK_F3 },
+    { Keyboard::Key::F4, SDL_SCANCODE_F4, SDLK_F4 },
+    { Keyboard::Key::F5, SDL_SCANCODE_F5, SDLK_F5 },
+    { Keyboard::Key::F6, SDL_SCANCODE_F6, SDLK_F6 },
+    { Keyboard::Key::F7, SDL_SCANCODE_F7, SDLK_F7 },
+    { Keyboard::Key::F8, SDL_SCANCODE_F8, SDLK_F8 },
+    { Keyboard::Key::F9, SDL_SCANCODE_F9, SDLK_F9 },
+    { Keyboard::Key::F10, SDL_SCANCODE_F10, SDLK_F10 },
+    { Keyboard::Key::F11, SDL_SCANCODE_F11, SDLK_F11 },
+    { Keyboard::Key::F12, SDL_SCANCODE_F12, SDLK_F12 },
+    { Keyboard::Key::Quote, SDL_SCANCODE_APOSTROPHE, SDLK_QUOTE },
+    { Keyboard::Key::Backslash, SDL_SCANCODE_BACKSLASH, SDLK_BACKSLASH },
+    { Keyboard::Key::Comma, SDL_SCANCODE_COMMA, SDLK_COMMA },
+    { Keyboard::Key::Equals, SDL_SCANCODE_EQUALS, SDLK_EQUALS },
+    { Keyboard::Key::BackQuote, SDL_SCANCODE_GRAVE, SDLK_BACKQUOTE },
+    { Keyboard::Key::NumDivide, SDL_SCANCODE_KP_DIVIDE, SDLK_KP_DIVIDE },
+    { Keyboard::Key::NumMinus, SDL_SCANCODE_KP_MINUS, SDLK_KP_MINUS },
+    { Keyboard::Key::NumMultiply, SDL_SCANCODE_KP_MULTIPLY, SDLK_KP_MULTIPLY },
+    { Keyboard::Key::NumPlus, SDL_SCANCODE_KP_PLUS, SDLK_KP_PLUS },
+    { Keyboard::Key::NumPeriod, SDL_SCANCODE_KP_PERIOD, SDLK_KP_PERIOD },
+    { Keyboard::Key::LeftBracket, SDL_SCANCODE_LEFTBRACKET, SDLK_LEFTBRACKET },
+    { Keyboard::Key::Minus, SDL_SCANCODE_MINUS, SDLK_MINUS },
+    { Keyboard::Key::Numlock, SDL_SCANCODE_NUMLOCKCLEAR, SDLK_NUMLOCKCLEAR },
+    { Keyboard::Key::Period, SDL_SCANCODE_PERIOD, SDLK_PERIOD },
+    { Keyboard::Key::RightBracket, SDL_SCANCODE_RIGHTBRACKET, SDLK_RIGHTBRACKET },
+    { Keyboard::Key::SemiColon, SDL_SCANCODE_SEMICOLON, SDLK_SEMICOLON },
+    { Keyboard::Key::Slash, SDL_SCANCODE_SLASH, SDLK_SLASH },
+    { Keyboard::Key::Application, SDL_SCANCODE_APPLICATION, SDLK_APPLICATION },
+    { Keyboard::Key::Backspace, SDL_SCANCODE_BACKSPACE, SDLK_BACKSPACE },
+    { Keyboard::Key::CapsLock, SDL_SCANCODE_CAPSLOCK, SDLK_CAPSLOCK },
+    { Keyboard::Key::Delete, SDL_SCANCODE_DELETE, SDLK_DELETE },
+    { Keyboard::Key::End, SDL_SCANCODE_END, SDLK_END },
+    { Keyboard::Key::Escape, SDL_SCANCODE_ESCAPE, SDLK_ESCAPE },
+    { Keyboard::Key::Insert, SDL_SCANCODE_INSERT, SDLK_INSERT },
+    { Keyboard::Key::NumEnter, SDL_SCANCODE_KP_ENTER, SDLK_KP_ENTER },
+    { Keyboard::Key::LeftAlt, SDL_SCANCODE_LALT, SDLK_LALT },
+    { Keyboard::Key::LeftCtrl, SDL_SCANCODE_LCTRL, SDLK_LCTRL },
+    { Keyboard::Key::LeftShift, SDL_SCANCODE_LSHIFT, SDLK_LSHIFT },
+    { Keyboard::Key::PageUp, SDL_SCANCODE_PAGEUP, SDLK_PAGEUP },
+    { Keyboard::Key::PageDown, SDL_SCANCODE_PAGEDOWN, SDLK_PAGEDOWN },
+    { Keyboard::Key::Pause, SDL_SCANCODE_PAUSE, SDLK_PAUSE },
+    { Keyboard::Key::PrintScreen, SDL_SCANCODE_PRINTSCREEN, SDLK_PRINTSCREEN },
+    { Keyboard::Key::RightAlt, SDL_SCANCODE_RALT, SDLK_RALT },
+    { Keyboard::Key::RightCtrl, SDL_SCANCODE_RCTRL, SDLK_RCTRL },
+    { Keyboard::Key::Return, SDL_SCANCODE_RETURN, SDLK_RETURN },
+    { Keyboard::Key::RightShift, SDL_SCANCODE_RSHIFT, SDLK_RSHIFT },
+    { Keyboard::Key::ScrollLock, SDL_SCANCODE_SCROLLLOCK, SDLK_SCROLLLOCK },
+    { Keyboard::Key::Space, SDL_SCANCODE_SPACE, SDLK_SPACE },
+    { Keyboard::Key::Tab, SDL_SCANCODE_TAB, SDLK_TAB }
+}};
+
+static_assert([] ()
+{
+    for(size_t i = 0 ; i < KEY_CODES.size() ; ++i)
+    {
+        if(static_cast<size_t>(KEY_CODES[i].key) != i)
+            return false;
+    }
+
+    return true;
+}(), "KEY_CODES must follow the order of Keyboard::Key");
+
+static_assert(Keyboard::KEY_COUNT < UINT8_MAX, "Keys must be indexable with 8 bits");
+
+inline constexpr uint8_t NO_KEY = UINT8_MAX; ///< Value of the lookup tables for codes that match no key
+
+inline constexpr size_t ASCII_KEYCODES_COUNT = 128; ///< Number of keycodes that are characters
+
+/////////////////////////////////////////////////
+/// \brief Scancode of each key, indexed by \a Keyboard::Key
+///
+/// \warning This is IKSDL internal code that should not be
+/// used outside of the library
+/////////////////////////////////////////////////
+inline constexpr std::array<SDL_Scancode, Keyboard::KEY_COUNT> KEY_SCANCODES = [] ()
+{
+    std::array<SDL_Scancode, Keyboard::KEY_COUNT> table{};
+    for(const KeyCodes& codes : KEY_CODES)
+        table[static_cast<size_t>(codes.key)] = codes.scancode;
+
+    return table;
+}();
+
+/////////////////////////////////////////////////
+/// \brief Key of each scancode, or \a NO_KEY
+///
+/// \warning This is IKSDL internal code that should not be
+/// used outside of the library
+/////////////////////////////////////////////////
+inline constexpr std::array<uint8_t, SDL_NUM_SCANCODES> SCANCODE_KEYS = [] ()
+{
+    std::array<uint8_t, SDL_NUM_SCANCODES> table{};
+    table.fill(NO_KEY);
+
+    for(const KeyCodes& codes : KEY_CODES)
+        table[codes.scancode] = static_cast<uint8_t>(codes.key);
+
+    return table;
+}();
+
+/////////////////////////////////////////////////
+/// \brief Key of each character keycode, or \a NO_KEY
+///
+/// \warning This is IKSDL internal code that should not be
+/// used outside of the library
+/////////////////////////////////////////////////
+inline constexpr std::array<uint8_t, ASCII_KEYCODES_COUNT> ASCII_KEYCODE_KEYS = [] ()
+{
+    std::array<uint8_t, ASCII_KEYCODES_COUNT> table{};
+    table.fill(NO_KEY);
+
+    for(const KeyCodes& codes : KEY_CODES)
+    {
+        if((codes.keycode & SDLK_SCANCODE_MASK) == 0)
+            table[codes.keycode] = static_cast<uint8_t>(codes.key);
+    }
+
+    return table;
+}();
+
+/////////////////////////////////////////////////
+/// \brief Key of each keycode built from a scancode, indexed by the scancode part, or \a NO_KEY
+///
+/// \warning This is IKSDL internal code that should not be
+/// used outside of the library
+/////////////////////////////////////////////////
+inline constexpr std::array<uint8_t, SDL_NUM_SCANCODES> MASKED_KEYCODE_KEYS = [] ()
+{
+    std::array<uint8_t, SDL_NUM_SCANCODES> table{};
+    table.fill(NO_KEY);
+
+    for(const KeyCodes& codes : KEY_CODES)
+    {
+        if((codes.keycode & SDLK_SCANCODE_MASK) != 0)
+            table[codes.keycode & ~SDLK_SCANCODE_MASK] = static_cast<uint8_t>(codes.key);
+    }
+
+    return table;
+}();
+
+/////////////////////////////////////////////////
+/// \brief Find the key matching an SDL keycode
+///
+/// \param keycode SDL keycode
+///
+/// \return Matching key, if any
+///
+/// \warning This is IKSDL internal code that should not be
+/// used outside of the library
+/////////////////////////////////////////////////
+inline std::optional<Keyboard::Key> keyFromKeycode(SDL_Keycode keycode)
+{
+    uint8_t key = NO_KEY;
+
+    if((keycode & SDLK_SCANCODE_MASK) != 0)
+    {
+        const auto index = static_cast<size_t>(keycode & ~SDLK_SCANCODE_MASK);
+        if(index < MASKED_KEYCODE_KEYS.size())
+            key = MASKED_KEYCODE_KEYS[index];
+    }
+    else if(keycode >= 0 && static_cast<size_t>(keycode) < ASCII_KEYCODE_KEYS.size())
+    {
+        key = ASCII_KEYCODE_KEYS[static_cast<size_t>(keycode)];
+    }
+
+    if(key == NO_KEY)
+        return std::nullopt;
+
+    return static_cast<Keyboard::Key>(key);
+}
+
+/////////////////////////////////////////////////
+/// \brief Find the key matching an SDL scancode
+///
+/// \param scancode SDL scancode
+///
+/// \return Matching key, if any
+///
+/// \warning This is IKSDL internal code that should not be
+/// used outside of the library
+/////////////////////////////////////////////////
+inline std::optional<Keyboard::Key> keyFromScancode(SDL_Scancode scancode)
+{
+    if(scancode < 0 || scancode >= SDL_NUM_SCANCODES || SCANCODE_KEYS[scancode] == NO_KEY)
+        return std::nullopt;
+
+    return static_cast<Keyboard::Key>(SCANCODE_KEYS[scancode]);
+}
+
+}
+
+#endif // IKSDL_KEY_TABLES_HPP
@@ -0,0 +1,468 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/Mixer.hpp"
+#include "iksdl/PerformanceCounter.hpp"
+#include "iksdl/SdlException.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace iksdl::priv
+{
+namespace
+{
+/////////////////////////////////////////////////
+/// \brief Scale of the 16-bit samples
+/////////////////////////////////////////////////
+constexpr float S16_SCALE = 32768.f;
+
+void accumulateS16Scalar(float* dst, const int16_t* src, size_t count, float evenGain, float oddGain)
+{
+    for(size_t i = 0 ; i + 1 < count ; i += 2)
+    {
+        dst[i] += src[i] * evenGain;
+        dst[i + 1] += src[i + 1] * oddGain;
+    }
+
+    if(count % 2 != 0)
+        dst[count - 1] += src[count - 1] * evenGain;
+}
+
+void accumulateF32Scalar(float* dst, const float* src, size_t count, float evenGain, float oddGain)
+{
+    for(size_t i = 0 ; i + 1 < count ; i += 2)
+    {
+        dst[i] += src[i] * evenGain;
+        dst[i + 1] += src[i + 1] * oddGain;
+    }
+
+    if(count % 2 != 0)
+        dst[count - 1] += src[count - 1] * evenGain;
+}
+
+void outputS16Scalar(int16_t* dst, const float* src, size_t count)
+{
+    for(size_t i = 0 ; i < count ; ++i)
+        dst[i] = static_cast<int16_t>(std::lrint(std::clamp(dst[i] + src[i] * S16_SCALE, -S16_SCALE, S16_SCALE - 1.f)));
+}
+
+void outputF32Scalar(float* dst, const float* src, size_t count)
+{
+    for(size_t i = 0 ; i < count ; ++i)
+        dst[i] = std::clamp(dst[i] + src[i], -1.f, 1.f);
+}
+}
+
+MixKernels scalarMixKernels()
+{
+    return MixKernels { .accumulateS16 = accumulateS16Scalar, .accumulateF32 = accumulateF32Scalar,
+                        .outputS16 = outputS16Scalar, .outputF32 = outputF32Scalar };
+}
+
+Mixer::Mixer() :
+    m_kernels(scalarMixKernels()),
+    m_installed(false),
+    m_frequency(0),
+    m_format(0),
+    m_channels(0),
+    m_frameSize(0),
+    m_generations(),
+    m_volumes(),
+    m_paused(),
+    m_nextSlot(0),
+    m_commandsHead(0),
+    m_commandsTail(0),
+    m_playingCount(0),
+    m_lastDuration(0),
+    m_peakDuration(0),
+    m_lastBufferDuration(0)
+{
+    for(std::atomic<uint32_t>& finished : m_finished)
+        finished.store(0, std::memory_order_relaxed);
+
+#ifdef IKSDL_MIXER_AVX2
+    if(SDL_HasAVX2())
+    {
+        m_kernels = avx2MixKernels();
+        return;
+    }
+#endif
+
+#ifdef IKSDL_MIXER_SSE41
+    if(SDL_HasSSE41())
+    {
+        m_kernels = sse41MixKernels();
+        return;
+    }
+#endif
+
+#ifdef IKSDL_MIXER_NEON
+    if(SDL_HasNEON())
+        m_kernels = neonMixKernels();
+#endif
+}
+
+void Mixer::install()
+{
+    if(m_installed)
+        return;
+
+    if(Mix_QuerySpec(&m_frequency, &m_format, &m_channels) == 0)
+        throw SdlException(std::string("Failed to install the mixing engine, the audio device is not opened. Cause: ") + Mix_GetError());
+
+    if((m_format != AUDIO_S16SYS && m_format != AUDIO_F32SYS) || m_channels < 1 || m_channels > 2)
+        throw SdlException("Failed to install the mixing engine, only 16-bit and float mono or stereo audio devices are supported");
+
+    m_frameSize = static_cast<size_t>(SDL_AUDIO_BITSIZE(m_format) / 8 * m_channels);
+    m_installed = true;
+
+    Mix_SetPostMix(&Mixer::mix, this);
+}
+
+void Mixer::uninstall()
+{
+    if(!m_installed)
+        return;
+
+    // once the callback is removed, the audio thread does not access the voices anymore
+    Mix_SetPostMix(nullptr, nullptr);
+    m_installed = false;
+
+    m_commandsHead.store(m_commandsTail.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    m_playingCount = 0;
+    for(size_t slot = 0 ; slot < MAX_VOICES ; ++slot)
+        m_finished[slot].store(m_generations[slot], std::memory_order_release);
+}
+
+int Mixer::play(Mix_Chunk* chunk, int loops, int ticks)
+{
+    // the size of a frame is only known once installed
+    if(!m_installed)
+        return -1;
+
+    const uint32_t frames = chunk->alen / static_cast<uint32_t>(m_frameSize);
+    if(frames == 0)
+        return -1;
+
+    // search a slot whose last voice finished, from the last allocated one
+    size_t slot = m_nextSlot;
+    for(size_t i = 0 ; i < MAX_VOICES ; ++i, slot = (slot + 1) % MAX_VOICES)
+    {
+        if(m_finished[slot].load(std::memory_order_acquire) == m_generations[slot])
+            break;
+    }
+
+    if(m_finished[slot].load(std::memory_order_acquire) != m_generations[slot])
+        return -1;
+
+    Command command {};
+    command.type = Command::Type::Play;
+    command.slot = static_cast<uint16_t>(slot);
+    command.generation = m_generations[slot] + 1;
+    command.data = chunk->abuf;
+    command.frames = frames;
+    command.loops = loops;
+    command.limit = ticks < 0 ? -1 : static_cast<int64_t>(ticks) * m_frequency / 1000;
+    command.gain = 1.f;
+    command.chunkGain = chunk->volume / static_cast<float>(MIX_MAX_VOLUME);
+    command.left = 1.f;
+    command.right = 1.f;
+
+    if(!push(command))
+        return -1;
+
+    m_generations[slot] = command.generation;
+    m_volumes[slot] = MIX_MAX_VOLUME;
+    m_paused[slot] = false;
+    m_nextSlot = (slot + 1) % MAX_VOICES;
+
+    return FIRST_CHANNEL + static_cast<int>(slot);
+}
+
+bool Mixer::isActive(int channel) const
+{
+    const size_t slot = static_cast<size_t>(channel - FIRST_CHANNEL);
+    return m_finished[slot].load(std::memory_order_acquire) != m_generations[slot];
+}
+
+void Mixer::stop(int channel)
+{
+    send(makeCommand(Command::Type::Stop, channel));
+}
+
+void Mixer::pause(int channel)
+{
+    send(makeCommand(Command::Type::Pause, channel));
+    m_paused[channel - FIRST_CHANNEL] = true;
+}
+
+void Mixer::resume(int channel)
+{
+    send(makeCommand(Command::Type::Resume, channel));
+    m_paused[channel - FIRST_CHANNEL] = false;
+}
+
+void Mixer::setVolume(int channel, int volume)
+{
+    volume = std::clamp(volume, 0, MIX_MAX_VOLUME);
+
+    Command command = makeCommand(Command::Type::Volume, channel);
+    command.gain = volume / static_cast<float>(MIX_MAX_VOLUME);
+
+    send(command);
+    m_volumes[channel - FIRST_CHANNEL] = volume;
+}
+
+void Mixer::setChunkVolume(int channel, int volume)
+{
+    Command command = makeCommand(Command::Type::ChunkVolume, channel);
+    command.chunkGain = std::clamp(volume, 0, MIX_MAX_VOLUME) / static_cast<float>(MIX_MAX_VOLUME);
+
+    send(command);
+}
+
+void Mixer::setPanning(int channel, uint8_t left, uint8_t right)
+{
+    Command command = makeCommand(Command::Type::Panning, channel);
+    command.left = left / 255.f;
+    command.right = right / 255.f;
+
+    send(command);
+}
+
+void Mixer::pauseAll()
+{
+    for(size_t slot = 0 ; slot < MAX_VOICES ; ++slot)
+    {
+        const int channel = FIRST_CHANNEL + static_cast<int>(slot);
+        if(isActive(channel))
+            pause(channel);
+    }
+}
+
+void Mixer::synchronize()
+{
+    // setting the callback waits for the running callback, the next
+    // ones apply all the waiting commands before mixing anything
+    if(m_installed)
+        Mix_SetPostMix(&Mixer::mix, this);
+}
+
+void Mixer::mix(void* userData, Uint8* stream, int length)
+{
+    static_cast<Mixer*>(userData)->process(stream, length);
+}
+
+void Mixer::process(Uint8* stream, int length)
+{
+    const Uint64 start = SDL_GetPerformanceCounter();
+
+    applyCommands();
+
+    const size_t frames = static_cast<size_t>(length) / m_frameSize;
+    for(size_t offset = 0 ; offset < frames && m_playingCount > 0 ; offset += BLOCK_FRAMES)
+    {
+        const size_t blockFrames = std::min(BLOCK_FRAMES, frames - offset);
+        const size_t samples = blockFrames * static_cast<size_t>(m_channels);
+        std::fill_n(m_block.begin(), samples, 0.f);
+
+        for(size_t i = 0 ; i < m_playingCount ; )
+        {
+            const uint16_t slot = m_playing[i];
+            if(mixVoice(m_voices[slot], blockFrames))
+            {
+                ++i;
+                continue;
+            }
+
+            m_finished[slot].store(m_voices[slot].generation, std::memory_order_release);
+            m_playing[i] = m_playing[--m_playingCount];
+        }
+
+        Uint8* output = stream + offset * m_frameSize;
+        if(m_format == AUDIO_S16SYS)
+            m_kernels.outputS16(reinterpret_cast<int16_t*>(output), m_block.data(), samples);
+        else
+            m_kernels.outputF32(reinterpret_cast<float*>(output), m_block.data(), samples);
+    }
+
+    const int64_t duration = toNanoseconds(SDL_GetPerformanceCounter() - start);
+    m_lastDuration.store(duration, std::memory_order_relaxed);
+    if(duration > m_peakDuration.load(std::memory_order_relaxed))
+        m_peakDuration.store(duration, std::memory_order_relaxed);
+    m_lastBufferDuration.store(static_cast<int64_t>(frames) * 1'000'000'000 / m_frequency, std::memory_order_relaxed);
+}
+
+void Mixer::apply(const Command& command)
+{
+    Voice& voice = m_voices[command.slot];
+
+    if(command.type == Command::Type::Play)
+    {
+        voice = Voice { .data = command.data, .frames = command.frames, .position = 0, .loops = command.loops,
+                        .limit = command.limit, .generation = command.generation, .gain = command.gain,
+                        .chunkGain = command.chunkGain, .left = command.left, .right = command.right, .paused = false };
+        m_playing[m_playingCount++] = command.slot;
+        return;
+    }
+
+    // the voice may have finished before the command arrived
+    if(voice.generation != command.generation || m_finished[command.slot].load(std::memory_order_relaxed) == command.generation)
+        return;
+
+    switch(command.type)
+    {
+        case Command::Type::Stop:
+            // stopped voices are removed by the next mixing
+            voice.loops = 0;
+            voice.limit = 0;
+            voice.paused = false;
+            break;
+
+        case Command::Type::Pause:
+            voice.paused = true;
+            break;
+
+        case Command::Type::Resume:
+            voice.paused = false;
+            break;
+
+        case Command::Type::Volume:
+            voice.gain = command.gain;
+            break;
+
+        case Command::Type::ChunkVolume:
+            voice.chunkGain = command.chunkGain;
+            break;
+
+        case Command::Type::Panning:
+            voice.left = command.left;
+            voice.right = command.right;
+            break;
+
+        default:
+            break;
+    }
+}
+
+bool Mixer::mixVoice(Voice& voice, size_t frames)
+{
+    if(voice.limit == 0)
+        return false;
+
+    if(voice.paused)
+        return true;
+
+    // like SDL_mixer, the volume of the voice is combined with the volume of the sound
+    float evenGain = voice.gain * voice.chunkGain;
+    float oddGain = evenGain;
+    if(m_channels == 2)
+    {
+        evenGain *= voice.left;
+        oddGain *= voice.right;
+    }
+
+    const size_t channels = static_cast<size_t>(m_channels);
+    size_t done = 0;
+    while(done < frames)
+    {
+        size_t count = std::min<size_t>(frames - done, voice.frames - voice.position);
+        if(voice.limit >= 0)
+            count = std::min<size_t>(count, static_cast<size_t>(voice.limit));
+
+        float* dst = m_block.data() + done * channels;
+        const Uint8* src = voice.data + voice.position * m_frameSize;
+        if(m_format == AUDIO_S16SYS)
+            m_kernels.accumulateS16(dst, reinterpret_cast<const int16_t*>(src), count * channels,
+                                    evenGain / S16_SCALE, oddGain / S16_SCALE);
+        else
+            m_kernels.accumulateF32(dst, reinterpret_cast<const float*>(src), count * channels, evenGain, oddGain);
+
+        done += count;
+        voice.position += static_cast<uint32_t>(count);
+        if(voice.limit >= 0)
+        {
+            voice.limit -= static_cast<int64_t>(count);
+            if(voice.limit == 0)
+                return false;
+        }
+
+        if(voice.position == voice.frames)
+        {
+            if(voice.loops == 0)
+                return false;
+
+            if(voice.loops > 0)
+                voice.loops--;
+            voice.position = 0;
+        }
+    }
+
+    return true;
+}
+
+bool Mixer::push(const Command& command)
+{
+    const size_t tail = m_commandsTail.load(std::memory_order_relaxed);
+    const size_t next = (tail + 1) % QUEUE_CAPACITY;
+    if(next == m_commandsHead.load(std::memory_order_acquire))
+        return false;
+
+    m_commands[tail] = command;
+    m_commandsTail.store(next, std::memory_order_release);
+    return true;
+}
+
+void Mixer::applyCommands()
+{
+    const size_t tail = m_commandsTail.load(std::memory_order_acquire);
+    size_t head = m_commandsHead.load(std::memory_order_relaxed);
+    for( ; head != tail ; head = (head + 1) % QUEUE_CAPACITY)
+        apply(m_commands[head]);
+    m_commandsHead.store(head, std::memory_order_release);
+}
+
+void Mixer::send(const Command& command)
+{
+    if(!m_installed || push(command))
+        return;
+
+    // the queue is full: the command must not be lost, since the sounds free
+    // their chunks once stopped, so remove the callback to exclude the audio
+    // thread and apply the waiting commands and this one from here
+    Mix_SetPostMix(nullptr, nullptr);
+    applyCommands();
+    apply(command);
+    Mix_SetPostMix(&Mixer::mix, this);
+}
+
+Mixer::Command Mixer::makeCommand(Command::Type type, int channel) const
+{
+    const size_t slot = static_cast<size_t>(channel - FIRST_CHANNEL);
+
+    Command command {};
+    command.type = type;
+    command.slot = static_cast<uint16_t>(slot);
+    command.generation = m_generations[slot];
+    return command;
+}
+}
@@ -0,0 +1,421 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_MIXER_HPP
+#define IKSDL_MIXER_HPP
+
+#include <SDL_mixer.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace iksdl::priv
+{
+
+/////////////////////////////////////////////////
+/// \brief Set of functions that mix blocks of interleaved samples
+///
+/// The mixing is done in floating point samples between -1 and 1.
+/// The gains alternate between the even and odd samples, which are
+/// the left and right samples in stereo.
+///
+/// \warning This is IKSDL internal code that should not be
+/// used outside of the library
+/////////////////////////////////////////////////
+struct MixKernels
+{
+    void (*accumulateS16)(float* dst, const int16_t* src, size_t count, float evenGain, float oddGain); ///< Add 16-bit samples multiplied by the gains
+    void (*accumulateF32)(float* dst, const float* src, size_t count, float evenGain, float oddGain);   ///< Add float samples multiplied by the gains
+    void (*outputS16)(int16_t* dst, const float* src, size_t count);                                    ///< Add mixed samples to a 16-bit stream, with saturation
+    void (*outputF32)(float* dst, const float* src, size_t count);                                      ///< Add mixed samples to a float stream, with saturation
+};
+
+/////////////////////////////////////////////////
+/// \brief Get the portable kernels
+///
+/// \return Kernels that run on any CPU
+/////////////////////////////////////////////////
+MixKernels scalarMixKernels();
+
+#ifdef IKSDL_MIXER_SSE41
+/////////////////////////////////////////////////
+/// \brief Get the kernels using SSE4.1 instructions
+///
+/// \return Kernels that require SSE4.1
+/////////////////////////////////////////////////
+MixKernels sse41MixKernels();
+#endif
+
+#ifdef IKSDL_MIXER_AVX2
+/////////////////////////////////////////////////
+/// \brief Get the kernels using AVX2 instructions
+///
+/// \return Kernels that require AVX2
+/////////////////////////////////////////////////
+MixKernels avx2MixKernels();
+#endif
+
+#ifdef IKSDL_MIXER_NEON
+/////////////////////////////////////////////////
+/// \brief Get the kernels using NEON instructions
+///
+/// \return Kernels that require NEON
+/////////////////////////////////////////////////
+MixKernels neonMixKernels();
+#endif
+
+/////////////////////////////////////////////////
+/// \brief Singleton mixing the sounds instead of SDL_mixer
+///
+/// Once installed as SDL_mixer's post-mix callback, the sounds are
+/// mixed here by blocks with vectorized kernels, after SDL_mixer
+/// has mixed its own channels and the music.
+///
+/// The voices are identified by channels numbered from
+/// \a FIRST_CHANNEL, so that they never collide with SDL_mixer's
+/// channels. The game thread controls them through a lock-free
+/// command queue, the audio thread reports the finished voices
+/// through atomic generation counters.
+///
+/// All the methods except the callback must be called from the main thread.
+///
+/// \warning This is IKSDL internal code that should not be
+/// used outside of the library
+/////////////////////////////////////////////////
+class Mixer
+{
+    public:
+
+        static constexpr int FIRST_CHANNEL = 4096; ///< Channel of the first voice, above SDL_mixer's channels
+        static constexpr int MAX_VOICES = 1024;    ///< Maximum number of simultaneous voices
+
+        /////////////////////////////////////////////////
+        /// \brief Get the singleton instance
+        ///
+        /// \return Singleton instance
+        /////////////////////////////////////////////////
+        inline static Mixer* getInstance() { static Mixer mixer; return &mixer; }
+
+        /////////////////////////////////////////////////
+        /// \brief Start mixing the sounds
+        ///
+        /// This method will throw \a SdlException if the audio device
+        /// is not opened, or if its format is not supported.
+        /////////////////////////////////////////////////
+        void install();
+
+        /////////////////////////////////////////////////
+        /// \brief Stop mixing the sounds, all the voices are stopped
+        /////////////////////////////////////////////////
+        void uninstall();
+
+        /////////////////////////////////////////////////
+        /// \brief Is the mixer installed?
+        ///
+        /// \return True if the sounds are mixed by this mixer
+        /////////////////////////////////////////////////
+        inline bool isInstalled() const { return m_installed; }
+
+        /////////////////////////////////////////////////
+        /// \brief Is a channel handled by this mixer?
+        ///
+        /// \param channel Channel of a voice
+        ///
+        /// \return True if the channel is not an SDL_mixer channel
+        /////////////////////////////////////////////////
+        inline static bool isMixerChannel(int channel) { return channel >= FIRST_CHANNEL; }
+
+        /////////////////////////////////////////////////
+        /// \brief Start a voice
+        ///
+        /// \param chunk Sound to play, it must stay loaded while the voice plays
+        /// \param loops Number of times to play the sound
+        /// \param ticks Maximum time to play the sound in milliseconds, -1 for no limit
+        ///
+        /// \return Channel of the voice, or -1 if no voice is available
+        /////////////////////////////////////////////////
+        int play(Mix_Chunk* chunk, int loops, int ticks);
+
+        /////////////////////////////////////////////////
+        /// \brief Is a voice still playing or paused?
+        ///
+        /// \param channel Channel of the voice
+        ///
+        /// \return True if the voice has not finished yet
+        /////////////////////////////////////////////////
+        bool isActive(int channel) const;
+
+        /////////////////////////////////////////////////
+        /// \brief Stop a voice
+        ///
+        /// The sound may still be mixed until \a synchronize returns.
+        ///
+        /// \param channel Channel of the voice
+        /////////////////////////////////////////////////
+        void stop(int channel);
+
+        /////////////////////////////////////////////////
+        /// \brief Pause a voice
+        ///
+        /// \param channel Channel of the voice
+        /////////////////////////////////////////////////
+        void pause(int channel);
+
+        /////////////////////////////////////////////////
+        /// \brief Resume a paused voice
+        ///
+        /// \param channel Channel of the voice
+        /////////////////////////////////////////////////
+        void resume(int channel);
+
+        /////////////////////////////////////////////////
+        /// \brief Set the volume of a voice
+        ///
+        /// It is multiplied by the volume of the sound played by the voice.
+        ///
+        /// \param channel Channel of the voice
+        /// \param volume  New volume of the voice, between 0 and 128
+        /////////////////////////////////////////////////
+        void setVolume(int channel, int volume);
+
+        /////////////////////////////////////////////////
+        /// \brief Set the volume of the sound played by a voice
+        ///
+        /// \param channel Channel of the voice
+        /// \param volume  New volume of the sound, between 0 and 128
+        /////////////////////////////////////////////////
+        void setChunkVolume(int channel, int volume);
+
+        /////////////////////////////////////////////////
+        /// \brief Set the volume of each side of a stereo voice
+        ///
+        /// \param channel Channel of the voice
+        /// \param left    Volume of the left side, between 0 and 255
+        /// \param right   Volume of the right side, between 0 and 255
+        /////////////////////////////////////////////////
+        void setPanning(int channel, uint8_t left, uint8_t right);
+
+        /////////////////////////////////////////////////
+        /// \brief Pause all the voices
+        /////////////////////////////////////////////////
+        void pauseAll();
+
+        /////////////////////////////////////////////////
+        /// \brief Is a voice paused?
+        ///
+        /// \param channel Channel of the voice
+        ///
+        /// \return True if the voice is paused
+        /////////////////////////////////////////////////
+        inline bool isPaused(int channel) const { return m_paused[channel - FIRST_CHANNEL]; }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the volume of a voice
+        ///
+        /// \param channel Channel of the voice
+        ///
+        /// \return Volume of the voice, between 0 and 128
+        /////////////////////////////////////////////////
+        inline int getVolume(int channel) const { return m_volumes[channel - FIRST_CHANNEL]; }
+
+        /////////////////////////////////////////////////
+        /// \brief Wait until the stopped voices cannot be mixed anymore
+        ///
+        /// Once this method returns, the sounds of the stopped
+        /// voices can be freed.
+        /////////////////////////////////////////////////
+        void synchronize();
+
+        /////////////////////////////////////////////////
+        /// \brief Get the CPU time of the last mixing
+        ///
+        /// \return Duration of the last callback
+        /////////////////////////////////////////////////
+        inline std::chrono::nanoseconds getLastMixDuration() const { return std::chrono::nanoseconds(m_lastDuration.load(std::memory_order_relaxed)); }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the CPU time of the longest mixing
+        ///
+        /// \return Duration of the longest callback since the installation or the last reset
+        /////////////////////////////////////////////////
+        inline std::chrono::nanoseconds getPeakMixDuration() const { return std::chrono::nanoseconds(m_peakDuration.load(std::memory_order_relaxed)); }
+
+        /////////////////////////////////////////////////
+        /// \brief Reset the CPU time of the longest mixing to 0
+        /////////////////////////////////////////////////
+        inline void resetPeakMixDuration() { m_peakDuration.store(0, std::memory_order_relaxed); }
+
+        /////////////////////////////////////////////////
+        /// \brief Get the duration of the audio mixed by the last callback
+        ///
+        /// \return Duration of the last mixed buffer
+        /////////////////////////////////////////////////
+        inline std::chrono::nanoseconds getLastBufferDuration() const { return std::chrono::nanoseconds(m_lastBufferDuration.load(std::memory_order_relaxed)); }
+
+    private:
+
+        static constexpr size_t BLOCK_FRAMES = 256;    ///< Number of frames mixed at once
+        static constexpr size_t QUEUE_CAPACITY = 4096; ///< Maximum number of commands waiting for the audio thread
+
+        /////////////////////////////////////////////////
+        /// \brief Request from the game thread to the audio thread
+        /////////////////////////////////////////////////
+        struct Command
+        {
+            enum class Type : uint8_t { Play, Stop, Pause, Resume, Volume, ChunkVolume, Panning };
+
+            Type type;           ///< Kind of request
+            uint16_t slot;       ///< Voice concerned by the request
+            uint32_t generation; ///< Generation of the voice, the request is ignored if the voice finished
+            const Uint8* data;   ///< Samples to play
+            uint32_t frames;     ///< Number of frames to play
+            int loops;           ///< Number of times to play the samples
+            int64_t limit;       ///< Maximum number of frames to play, -1 for no limit
+            float gain;          ///< Volume of the voice, between 0 and 1
+            float chunkGain;     ///< Volume of the sound, between 0 and 1
+            float left;          ///< Volume of the left side, between 0 and 1
+            float right;         ///< Volume of the right side, between 0 and 1
+        };
+
+        /////////////////////////////////////////////////
+        /// \brief State of a voice, owned by the audio thread
+        /////////////////////////////////////////////////
+        struct Voice
+        {
+            const Uint8* data;   ///< Samples to play
+            uint32_t frames;     ///< Number of frames in the samples
+            uint32_t position;   ///< Next frame to play
+            int loops;           ///< Number of remaining repetitions, -1 for infinite
+            int64_t limit;       ///< Remaining frames before the time limit, -1 for no limit
+            uint32_t generation; ///< Generation of the voice
+            float gain;          ///< Volume of the voice, between 0 and 1
+            float chunkGain;     ///< Volume of the sound, multiplied with the volume of the voice
+            float left;          ///< Volume of the left side, between 0 and 1
+            float right;         ///< Volume of the right side, between 0 and 1
+            bool paused;         ///< Is the voice paused?
+        };
+
+        /////////////////////////////////////////////////
+        /// \brief Default constructor, selecting the best kernels for the current CPU
+        /////////////////////////////////////////////////
+        Mixer();
+
+        /////////////////////////////////////////////////
+        /// \brief Post-mix callback of SDL_mixer
+        ///
+        /// \param userData Mixer instance
+        /// \param stream   Samples already mixed by SDL_mixer
+        /// \param length   Size of the stream in bytes
+        /////////////////////////////////////////////////
+        static void mix(void* userData, Uint8* stream, int length);
+
+        /////////////////////////////////////////////////
+        /// \brief Apply the commands and add the voices to the stream
+        ///
+        /// \param stream Samples already mixed by SDL_mixer
+        /// \param length Size of the stream in bytes
+        /////////////////////////////////////////////////
+        void process(Uint8* stream, int length);
+
+        /////////////////////////////////////////////////
+        /// \brief Apply a command on the audio thread
+        ///
+        /// \param command Request from the game thread
+        /////////////////////////////////////////////////
+        void apply(const Command& command);
+
+        /////////////////////////////////////////////////
+        /// \brief Add a block of a voice to the mixed samples
+        ///
+        /// \param voice  Voice to mix
+        /// \param frames Number of frames of the block
+        ///
+        /// \return False if the voice finished
+        /////////////////////////////////////////////////
+        bool mixVoice(Voice& voice, size_t frames);
+
+        /////////////////////////////////////////////////
+        /// \brief Send a command to the audio thread
+        ///
+        /// \param command Request to send
+        ///
+        /// \return False if the queue is full
+        /////////////////////////////////////////////////
+        bool push(const Command& command);
+
+        /////////////////////////////////////////////////
+        /// \brief Send a command that must not be dropped
+        ///
+        /// When the queue is full, the audio thread is excluded and the
+        /// command is applied from the calling thread.
+        ///
+        /// \param command Request to send
+        /////////////////////////////////////////////////
+        void send(const Command& command);
+
+        /////////////////////////////////////////////////
+        /// \brief Apply all the commands waiting in the queue
+        /////////////////////////////////////////////////
+        void applyCommands();
+
+        /////////////////////////////////////////////////
+        /// \brief Prepare a command about the current voice of a channel
+        ///
+        /// \param type    Kind of request
+        /// \param channel Channel of the voice
+        ///
+        /// \return Command to complete before sending it
+        /////////////////////////////////////////////////
+        Command makeCommand(Command::Type type, int channel) const;
+
+        MixKernels m_kernels; ///< Kernels used to mix the samples
+        bool m_installed;     ///< Is the post-mix callback installed?
+        int m_frequency;      ///< Frequency of the audio device
+        Uint16 m_format;      ///< Sample format of the audio device
+        int m_channels;       ///< Number of channels of the audio device
+        size_t m_frameSize;   ///< Size of a frame in bytes
+
+        std::array<uint32_t, MAX_VOICES> m_generations;           ///< Generation of the last started voice of each slot, owned by the game thread
+        std::array<std::atomic<uint32_t>, MAX_VOICES> m_finished; ///< Generation of the last finished voice of each slot, written by the audio thread
+        std::array<int, MAX_VOICES> m_volumes;                    ///< Volume of each voice, between 0 and 128, owned by the game thread
+        std::array<bool, MAX_VOICES> m_paused;                    ///< Pause state of each voice, owned by the game thread
+        size_t m_nextSlot;                                        ///< Slot where the search of a free slot starts
+
+        std::array<Command, QUEUE_CAPACITY> m_commands; ///< Ring buffer of commands
+        std::atomic<size_t> m_commandsHead;             ///< Next command to read, written by the audio thread
+        std::atomic<size_t> m_commandsTail;             ///< Next command to write, written by the game thread
+
+        std::array<Voice, MAX_VOICES> m_voices;      ///< State of the voices, owned by the audio thread
+        std::array<uint16_t, MAX_VOICES> m_playing;  ///< Slots of the playing voices, owned by the audio thread
+        size_t m_playingCount;                       ///< Number of playing voices, owned by the audio thread
+        std::array<float, BLOCK_FRAMES * 2> m_block; ///< Mixed samples of the current block
+
+        std::atomic<int64_t> m_lastDuration;       ///< Time spent in the last callback, in nanoseconds
+        std::atomic<int64_t> m_peakDuration;       ///< Longest time spent in a callback, in nanoseconds
+        std::atomic<int64_t> m_lastBufferDuration; ///< Duration of the audio in the last callback, in nanoseconds
+};
+
+}
+
+#endif // IKSDL_MIXER_HPP
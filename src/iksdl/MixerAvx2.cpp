@@ -0,0 +1,111 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/Mixer.hpp"
+#include <immintrin.h>
+
+namespace iksdl::priv
+{
+namespace
+{
+/////////////////////////////////////////////////
+/// \brief Get the kernels used for the samples that do not fill a whole register
+/////////////////////////////////////////////////
+inline const MixKernels& scalar()
+{
+    static const MixKernels kernels = scalarMixKernels();
+    return kernels;
+}
+
+void accumulateS16Avx2(float* dst, const int16_t* src, size_t count, float evenGain, float oddGain)
+{
+    const __m256 gains = _mm256_setr_ps(evenGain, oddGain, evenGain, oddGain, evenGain, oddGain, evenGain, oddGain);
+
+    size_t i = 0;
+    for( ; i + 8 <= count ; i += 8)
+    {
+        const __m256i s = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        const __m256 d = _mm256_loadu_ps(dst + i);
+        _mm256_storeu_ps(dst + i, _mm256_add_ps(d, _mm256_mul_ps(_mm256_cvtepi32_ps(s), gains)));
+    }
+
+    // i is a multiple of 8, the remaining samples keep the same parity
+    scalar().accumulateS16(dst + i, src + i, count - i, evenGain, oddGain);
+}
+
+void accumulateF32Avx2(float* dst, const float* src, size_t count, float evenGain, float oddGain)
+{
+    const __m256 gains = _mm256_setr_ps(evenGain, oddGain, evenGain, oddGain, evenGain, oddGain, evenGain, oddGain);
+
+    size_t i = 0;
+    for( ; i + 8 <= count ; i += 8)
+    {
+        const __m256 d = _mm256_loadu_ps(dst + i);
+        _mm256_storeu_ps(dst + i, _mm256_add_ps(d, _mm256_mul_ps(_mm256_loadu_ps(src + i), gains)));
+    }
+
+    scalar().accumulateF32(dst + i, src + i, count - i, evenGain, oddGain);
+}
+
+void outputS16Avx2(int16_t* dst, const float* src, size_t count)
+{
+    const __m256 scale = _mm256_set1_ps(32768.f);
+    const __m256 low = _mm256_set1_ps(-32768.f);
+    const __m256 high = _mm256_set1_ps(32767.f);
+
+    size_t i = 0;
+    for( ; i + 8 <= count ; i += 8)
+    {
+        const __m256 d = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i))));
+        const __m256 mixed = _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(d, _mm256_mul_ps(_mm256_loadu_ps(src + i), scale)), low), high);
+        const __m256i converted = _mm256_cvtps_epi32(mixed);
+
+        // packing works on each 128-bit lane, gather the two packed halves
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(converted, converted), _MM_SHUFFLE(3, 1, 2, 0));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_castsi256_si128(packed));
+    }
+
+    scalar().outputS16(dst + i, src + i, count - i);
+}
+
+void outputF32Avx2(float* dst, const float* src, size_t count)
+{
+    const __m256 low = _mm256_set1_ps(-1.f);
+    const __m256 high = _mm256_set1_ps(1.f);
+
+    size_t i = 0;
+    for( ; i + 8 <= count ; i += 8)
+    {
+        const __m256 mixed = _mm256_add_ps(_mm256_loadu_ps(dst + i), _mm256_loadu_ps(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_min_ps(_mm256_max_ps(mixed, low), high));
+    }
+
+    scalar().outputF32(dst + i, src + i, count - i);
+}
+}
+
+MixKernels avx2MixKernels()
+{
+    return MixKernels { .accumulateS16 = accumulateS16Avx2, .accumulateF32 = accumulateF32Avx2,
+                        .outputS16 = outputS16Avx2, .outputF32 = outputF32Avx2 };
+}
+}
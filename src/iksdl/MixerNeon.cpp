@@ -0,0 +1,110 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/Mixer.hpp"
+#include <arm_neon.h>
+
+namespace iksdl::priv
+{
+namespace
+{
+/////////////////////////////////////////////////
+/// \brief Get the kernels used for the samples that do not fill a whole register
+/////////////////////////////////////////////////
+inline const MixKernels& scalar()
+{
+    static const MixKernels kernels = scalarMixKernels();
+    return kernels;
+}
+
+/////////////////////////////////////////////////
+/// \brief Get the gains of four samples
+/////////////////////////////////////////////////
+inline float32x4_t gains(float evenGain, float oddGain)
+{
+    const float values[4] = { evenGain, oddGain, evenGain, oddGain };
+    return vld1q_f32(values);
+}
+
+void accumulateS16Neon(float* dst, const int16_t* src, size_t count, float evenGain, float oddGain)
+{
+    const float32x4_t g = gains(evenGain, oddGain);
+
+    size_t i = 0;
+    for( ; i + 4 <= count ; i += 4)
+    {
+        const float32x4_t s = vcvtq_f32_s32(vmovl_s16(vld1_s16(src + i)));
+        vst1q_f32(dst + i, vmlaq_f32(vld1q_f32(dst + i), s, g));
+    }
+
+    // i is a multiple of 4, the remaining samples keep the same parity
+    scalar().accumulateS16(dst + i, src + i, count - i, evenGain, oddGain);
+}
+
+void accumulateF32Neon(float* dst, const float* src, size_t count, float evenGain, float oddGain)
+{
+    const float32x4_t g = gains(evenGain, oddGain);
+
+    size_t i = 0;
+    for( ; i + 4 <= count ; i += 4)
+        vst1q_f32(dst + i, vmlaq_f32(vld1q_f32(dst + i), vld1q_f32(src + i), g));
+
+    scalar().accumulateF32(dst + i, src + i, count - i, evenGain, oddGain);
+}
+
+void outputS16Neon(int16_t* dst, const float* src, size_t count)
+{
+    const float32x4_t scale = vdupq_n_f32(32768.f);
+
+    size_t i = 0;
+    for( ; i + 4 <= count ; i += 4)
+    {
+        const float32x4_t d = vcvtq_f32_s32(vmovl_s16(vld1_s16(dst + i)));
+        const int32x4_t mixed = vcvtnq_s32_f32(vmlaq_f32(d, vld1q_f32(src + i), scale));
+        vst1_s16(dst + i, vqmovn_s32(mixed));
+    }
+
+    scalar().outputS16(dst + i, src + i, count - i);
+}
+
+void outputF32Neon(float* dst, const float* src, size_t count)
+{
+    const float32x4_t low = vdupq_n_f32(-1.f);
+    const float32x4_t high = vdupq_n_f32(1.f);
+
+    size_t i = 0;
+    for( ; i + 4 <= count ; i += 4)
+    {
+        const float32x4_t mixed = vaddq_f32(vld1q_f32(dst + i), vld1q_f32(src + i));
+        vst1q_f32(dst + i, vminq_f32(vmaxq_f32(mixed, low), high));
+    }
+
+    scalar().outputF32(dst + i, src + i, count - i);
+}
+}
+
+MixKernels neonMixKernels()
+{
+    return MixKernels { .accumulateS16 = accumulateS16Neon, .accumulateF32 = accumulateF32Neon,
+                        .outputS16 = outputS16Neon, .outputF32 = outputF32Neon };
+}
+}
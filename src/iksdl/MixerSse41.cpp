@@ -0,0 +1,108 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/Mixer.hpp"
+#include <smmintrin.h>
+
+namespace iksdl::priv
+{
+namespace
+{
+/////////////////////////////////////////////////
+/// \brief Get the kernels used for the samples that do not fill a whole register
+/////////////////////////////////////////////////
+inline const MixKernels& scalar()
+{
+    static const MixKernels kernels = scalarMixKernels();
+    return kernels;
+}
+
+void accumulateS16Sse41(float* dst, const int16_t* src, size_t count, float evenGain, float oddGain)
+{
+    const __m128 gains = _mm_setr_ps(evenGain, oddGain, evenGain, oddGain);
+
+    size_t i = 0;
+    for( ; i + 4 <= count ; i += 4)
+    {
+        const __m128i s = _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+        const __m128 d = _mm_loadu_ps(dst + i);
+        _mm_storeu_ps(dst + i, _mm_add_ps(d, _mm_mul_ps(_mm_cvtepi32_ps(s), gains)));
+    }
+
+    // i is a multiple of 4, the remaining samples keep the same parity
+    scalar().accumulateS16(dst + i, src + i, count - i, evenGain, oddGain);
+}
+
+void accumulateF32Sse41(float* dst, const float* src, size_t count, float evenGain, float oddGain)
+{
+    const __m128 gains = _mm_setr_ps(evenGain, oddGain, evenGain, oddGain);
+
+    size_t i = 0;
+    for( ; i + 4 <= count ; i += 4)
+    {
+        const __m128 d = _mm_loadu_ps(dst + i);
+        _mm_storeu_ps(dst + i, _mm_add_ps(d, _mm_mul_ps(_mm_loadu_ps(src + i), gains)));
+    }
+
+    scalar().accumulateF32(dst + i, src + i, count - i, evenGain, oddGain);
+}
+
+void outputS16Sse41(int16_t* dst, const float* src, size_t count)
+{
+    const __m128 scale = _mm_set1_ps(32768.f);
+    const __m128 low = _mm_set1_ps(-32768.f);
+    const __m128 high = _mm_set1_ps(32767.f);
+
+    size_t i = 0;
+    for( ; i + 4 <= count ; i += 4)
+    {
+        const __m128 d = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(dst + i))));
+        const __m128 mixed = _mm_min_ps(_mm_max_ps(_mm_add_ps(d, _mm_mul_ps(_mm_loadu_ps(src + i), scale)), low), high);
+        const __m128i packed = _mm_cvtps_epi32(mixed);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi32(packed, packed));
+    }
+
+    scalar().outputS16(dst + i, src + i, count - i);
+}
+
+void outputF32Sse41(float* dst, const float* src, size_t count)
+{
+    const __m128 low = _mm_set1_ps(-1.f);
+    const __m128 high = _mm_set1_ps(1.f);
+
+    size_t i = 0;
+    for( ; i + 4 <= count ; i += 4)
+    {
+        const __m128 mixed = _mm_add_ps(_mm_loadu_ps(dst + i), _mm_loadu_ps(src + i));
+        _mm_storeu_ps(dst + i, _mm_min_ps(_mm_max_ps(mixed, low), high));
+    }
+
+    scalar().outputF32(dst + i, src + i, count - i);
+}
+}
+
+MixKernels sse41MixKernels()
+{
+    return MixKernels { .accumulateS16 = accumulateS16Sse41, .accumulateF32 = accumulateF32Sse41,
+                        .outputS16 = outputS16Sse41, .outputF32 = outputF32Sse41 };
+}
+}
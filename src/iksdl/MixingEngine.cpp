@@ -0,0 +1,68 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/MixingEngine.hpp"
+#include "iksdl/Mixer.hpp"
+
+namespace iksdl
+{
+void MixingEngine::install()
+{
+    priv::Mixer::getInstance()->install();
+}
+
+void MixingEngine::uninstall()
+{
+    priv::Mixer::getInstance()->uninstall();
+}
+
+bool MixingEngine::isInstalled()
+{
+    return priv::Mixer::getInstance()->isInstalled();
+}
+
+std::chrono::nanoseconds MixingEngine::getLastMixDuration()
+{
+    return priv::Mixer::getInstance()->getLastMixDuration();
+}
+
+std::chrono::nanoseconds MixingEngine::getPeakMixDuration()
+{
+    return priv::Mixer::getInstance()->getPeakMixDuration();
+}
+
+void MixingEngine::resetPeakMixDuration()
+{
+    priv::Mixer::getInstance()->resetPeakMixDuration();
+}
+
+double MixingEngine::getMixLoad()
+{
+    const priv::Mixer* mixer = priv::Mixer::getInstance();
+    const std::chrono::nanoseconds buffer = mixer->getLastBufferDuration();
+
+    if(buffer.count() == 0)
+        return 0.;
+
+    return static_cast<double>(mixer->getLastMixDuration().count()) / static_cast<double>(buffer.count());
+}
+}
@@ -22,6 +22,7 @@
 
 #include "iksdl/Music.hpp"
 #include "iksdl/InvalidParameterException.hpp"
+#include "iksdl/Initializer.hpp"
 #include <utility>
 
 namespace iksdl
@@ -29,19 +30,26 @@ namespace iksdl
 Music::Music(const std::string& filePath) :
     m_music(nullptr)
 {
+    priv::Initializer* initializer = priv::Initializer::getInstance();
+    initializer->acquire(Subsystems::Type::Audio);
+
     m_music = Mix_LoadMUS(filePath.c_str());
 
     if(m_music == nullptr)
-        throw InvalidParameterException("Failed to load music from path " + filePath + ". Cause: " + Mix_GetError());
+    {
+        const std::string error = Mix_GetError();
+        initializer->release(Subsystems::Type::Audio);
+        throw InvalidParameterException("Failed to load music from path " + filePath + ". Cause: " + error);
+    }
 }
 
 Music::Music(Music&& other) :
-    m_music(std::exchange(m_music, other.m_music))
+    m_music(std::exchange(other.m_music, nullptr))
 {}
 
 Music::~Music()
 {
-    Mix_FreeMusic(m_music);
+    free();
 }
 
 Music& Music::operator=(Music&& other)
@@ -49,9 +57,19 @@ Music& Music::operator=(Music&& other)
     if(this == &other)
         return *this;
 
-    Mix_FreeMusic(m_music);
-    m_music = std::exchange(m_music, other.m_music);
+    free();
+    m_music = std::exchange(other.m_music, nullptr);
 
     return *this;
 }
+
+void Music::free()
+{
+    // A moved music does not use the audio device anymore
+    if(m_music == nullptr)
+        return;
+
+    Mix_FreeMusic(m_music);
+    priv::Initializer::getInstance()->release(Subsystems::Type::Audio);
+}
 }
@@ -0,0 +1,52 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#ifndef IKSDL_PERFORMANCE_COUNTER_HPP
+#define IKSDL_PERFORMANCE_COUNTER_HPP
+
+#include <SDL.h>
+#include <cstdint>
+
+namespace iksdl::priv
+{
+
+/////////////////////////////////////////////////
+/// \brief Convert a number of ticks of the performance counter to nanoseconds
+///
+/// The division is split so that long durations do not overflow.
+///
+/// \warning This is IKSDL internal code that should not be
+/// used outside of the library
+///
+/// \param counter Number of ticks
+///
+/// \return Duration in nanoseconds
+/////////////////////////////////////////////////
+inline int64_t toNanoseconds(Uint64 counter)
+{
+    static const Uint64 frequency = SDL_GetPerformanceFrequency();
+    return static_cast<int64_t>(counter / frequency * 1'000'000'000 + counter % frequency * 1'000'000'000 / frequency);
+}
+
+}
+
+#endif // IKSDL_PERFORMANCE_COUNTER_HPP
@@ -0,0 +1,333 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/RenderCommandList.hpp"
+#include "iksdl/Texture.hpp"
+#include "iksdl/Sprite.hpp"
+#include "iksdl/Spritef.hpp"
+#include "iksdl/Rectangle.hpp"
+#include "iksdl/Rectanglef.hpp"
+#include "iksdl/FillRectangle.hpp"
+#include "iksdl/FillRectanglef.hpp"
+#include "iksdl/RectangleArray.hpp"
+#include "iksdl/RectangleArrayf.hpp"
+#include "iksdl/FillRectangleArray.hpp"
+#include "iksdl/FillRectangleArrayf.hpp"
+#include "iksdl/Blitter.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace iksdl
+{
+RenderCommandList::RenderCommandList() :
+    m_sortKey(0)
+{}
+
+void RenderCommandList::clear(const Color& clearColor)
+{
+    push(Command::Type::Clear, clearColor, 0, 0);
+}
+
+void RenderCommandList::setViewport(const Recti& viewport)
+{
+    Command command = {};
+    command.type = Command::Type::Viewport;
+    command.key = m_sortKey;
+    command.source = { .x = viewport.getX(), .y = viewport.getY(), .w = viewport.getWidth(), .h = viewport.getHeight() };
+    m_commands.push_back(command);
+}
+
+void RenderCommandList::resetViewport()
+{
+    Command command = {};
+    command.type = Command::Type::ResetViewport;
+    command.key = m_sortKey;
+    m_commands.push_back(command);
+}
+
+void RenderCommandList::record(const Sprite& sprite)
+{
+    // Integer coordinates are exactly represented as floats, and SDL converts them to floats anyway
+    Command command = {};
+    command.type = Command::Type::Sprite;
+    command.key = m_sortKey;
+    command.texture = sprite.m_texture;
+    command.hasSource = sprite.m_textureRectPtr != nullptr;
+    command.source = sprite.m_textureRect;
+    command.destination = { .x = static_cast<float>(sprite.m_rect.x), .y = static_cast<float>(sprite.m_rect.y),
+                            .w = static_cast<float>(sprite.m_rect.w), .h = static_cast<float>(sprite.m_rect.h) };
+    command.hasCenter = sprite.m_centerPtr != nullptr;
+    command.center = { .x = static_cast<float>(sprite.m_center.x), .y = static_cast<float>(sprite.m_center.y) };
+    command.rotation = sprite.m_rotation;
+    command.flip = sprite.m_flip;
+    m_commands.push_back(command);
+}
+
+void RenderCommandList::record(const Spritef& sprite)
+{
+    Command command = {};
+    command.type = Command::Type::Sprite;
+    command.key = m_sortKey;
+    command.texture = sprite.m_texture;
+    command.hasSource = sprite.m_textureRectPtr != nullptr;
+    command.source = sprite.m_textureRect;
+    command.destination = sprite.m_rect;
+    command.hasCenter = sprite.m_centerPtr != nullptr;
+    command.center = sprite.m_center;
+    command.rotation = sprite.m_rotation;
+    command.flip = sprite.m_flip;
+    m_commands.push_back(command);
+}
+
+void RenderCommandList::record(const Rectangle& rectangle)
+{
+    recordRectangle(rectangle, Command::Type::Rects);
+}
+
+void RenderCommandList::record(const Rectanglef& rectangle)
+{
+    recordRectangle(rectangle, Command::Type::Rects);
+}
+
+void RenderCommandList::record(const FillRectangle& rectangle)
+{
+    recordRectangle(rectangle, Command::Type::FillRects);
+}
+
+void RenderCommandList::record(const FillRectanglef& rectangle)
+{
+    recordRectangle(rectangle, Command::Type::FillRects);
+}
+
+void RenderCommandList::record(const RectangleArray& rectangles)
+{
+    recordRectangles(rectangles, Command::Type::Rects);
+}
+
+void RenderCommandList::record(const RectangleArrayf& rectangles)
+{
+    recordRectangles(rectangles, Command::Type::Rects);
+}
+
+void RenderCommandList::record(const FillRectangleArray& rectangles)
+{
+    recordRectangles(rectangles, Command::Type::FillRects);
+}
+
+void RenderCommandList::record(const FillRectangleArrayf& rectangles)
+{
+    recordRectangles(rectangles, Command::Type::FillRects);
+}
+
+void RenderCommandList::record(const Line& line)
+{
+    const size_t first = m_points.size();
+    m_points.push_back({ .x = static_cast<float>(line.getPosition1().getX()), .y = static_cast<float>(line.getPosition1().getY()) });
+    m_points.push_back({ .x = static_cast<float>(line.getPosition2().getX()), .y = static_cast<float>(line.getPosition2().getY()) });
+    push(Command::Type::Lines, line.getColor(), first, 2);
+}
+
+void RenderCommandList::record(const Linef& line)
+{
+    const size_t first = m_points.size();
+    m_points.push_back({ .x = line.getPosition1().getX(), .y = line.getPosition1().getY() });
+    m_points.push_back({ .x = line.getPosition2().getX(), .y = line.getPosition2().getY() });
+    push(Command::Type::Lines, line.getColor(), first, 2);
+}
+
+void RenderCommandList::record(const Point& point)
+{
+    const size_t first = m_points.size();
+    m_points.push_back({ .x = static_cast<float>(point.getPosition().getX()), .y = static_cast<float>(point.getPosition().getY()) });
+    push(Command::Type::Points, point.getColor(), first, 1);
+}
+
+void RenderCommandList::record(const Pointf& point)
+{
+    const size_t first = m_points.size();
+    m_points.push_back({ .x = point.getPosition().getX(), .y = point.getPosition().getY() });
+    push(Command::Type::Points, point.getColor(), first, 1);
+}
+
+void RenderCommandList::merge(const std::vector<RenderCommandList>& lists)
+{
+    size_t commandsCount = 0;
+    size_t rectsCount = m_rects.size();
+    size_t pointsCount = m_points.size();
+    for(const RenderCommandList& list : lists)
+    {
+        commandsCount += list.m_commands.size();
+        rectsCount += list.m_rects.size();
+        pointsCount += list.m_points.size();
+    }
+
+    m_rects.reserve(rectsCount);
+    m_points.reserve(pointsCount);
+
+    // Gather the commands with their rectangles and points, and remember their order
+    std::vector<Command> commands;
+    std::vector<std::pair<uint64_t, uint32_t>> order;
+    commands.reserve(commandsCount);
+    order.reserve(commandsCount);
+
+    for(const RenderCommandList& list : lists)
+    {
+        const uint32_t rectsOffset = static_cast<uint32_t>(m_rects.size());
+        const uint32_t pointsOffset = static_cast<uint32_t>(m_points.size());
+        m_rects.insert(m_rects.end(), list.m_rects.begin(), list.m_rects.end());
+        m_points.insert(m_points.end(), list.m_points.begin(), list.m_points.end());
+
+        for(Command command : list.m_commands)
+        {
+            if(command.type == Command::Type::Rects || command.type == Command::Type::FillRects)
+                command.first += rectsOffset;
+            else if(command.type == Command::Type::Lines || command.type == Command::Type::Points)
+                command.first += pointsOffset;
+
+            order.emplace_back(command.key, static_cast<uint32_t>(commands.size()));
+            commands.push_back(command);
+        }
+    }
+
+    // The gathering index breaks the ties, so that equal keys keep the order of the lists
+    if(!std::is_sorted(commands.begin(), commands.end(), [](const Command& a, const Command& b) { return a.key < b.key; }))
+        std::sort(order.begin(), order.end());
+
+    m_commands.reserve(m_commands.size() + commandsCount);
+    for(const auto& [key, index] : order)
+        m_commands.push_back(commands[index]);
+}
+
+void RenderCommandList::reset()
+{
+    m_commands.clear();
+    m_rects.clear();
+    m_points.clear();
+    m_sortKey = 0;
+}
+
+void RenderCommandList::draw(SDL_Renderer* const renderer) const
+{
+    for(const Command& command : m_commands)
+    {
+        switch(command.type)
+        {
+            case Command::Type::Clear:
+                SDL_SetRenderDrawColor(renderer, command.color.r, command.color.g, command.color.b, command.color.a);
+                SDL_RenderClear(renderer);
+                break;
+
+            case Command::Type::Viewport:
+                SDL_RenderSetViewport(renderer, &command.source);
+                break;
+
+            case Command::Type::ResetViewport:
+                SDL_RenderSetViewport(renderer, nullptr);
+                break;
+
+            case Command::Type::Sprite:
+            {
+                const Texture& texture = *command.texture;
+                const SDL_Rect* const source = command.hasSource ? &command.source : nullptr;
+
+                if(command.rotation == 0.0 && command.flip == SDL_FLIP_NONE)
+                {
+                    // Same path as the sprites, with the vectorized blitter for software rendering
+                    if(texture.m_pixels == nullptr ||
+                       !priv::Blitter::getInstance().blit(renderer, texture.m_texture, *texture.m_pixels, source,
+                                                          SDL_Rect { .x = static_cast<int>(command.destination.x),
+                                                                     .y = static_cast<int>(command.destination.y),
+                                                                     .w = static_cast<int>(command.destination.w),
+                                                                     .h = static_cast<int>(command.destination.h) }))
+                        SDL_RenderCopyF(renderer, texture.m_texture, source, &command.destination);
+                }
+                else
+                    SDL_RenderCopyExF(renderer, texture.m_texture, source, &command.destination, command.rotation,
+                                      command.hasCenter ? &command.center : nullptr, command.flip);
+                break;
+            }
+
+            case Command::Type::Rects:
+                SDL_SetRenderDrawColor(renderer, command.color.r, command.color.g, command.color.b, command.color.a);
+                SDL_RenderDrawRectsF(renderer, m_rects.data() + command.first, static_cast<int>(command.count));
+                break;
+
+            case Command::Type::FillRects:
+                SDL_SetRenderDrawColor(renderer, command.color.r, command.color.g, command.color.b, command.color.a);
+                SDL_RenderFillRectsF(renderer, m_rects.data() + command.first, static_cast<int>(command.count));
+                break;
+
+            case Command::Type::Lines:
+                SDL_SetRenderDrawColor(renderer, command.color.r, command.color.g, command.color.b, command.color.a);
+                SDL_RenderDrawLinesF(renderer, m_points.data() + command.first, static_cast<int>(command.count));
+                break;
+
+            case Command::Type::Points:
+                SDL_SetRenderDrawColor(renderer, command.color.r, command.color.g, command.color.b, command.color.a);
+                SDL_RenderDrawPointsF(renderer, m_points.data() + command.first, static_cast<int>(command.count));
+                break;
+        }
+    }
+}
+
+void RenderCommandList::push(Command::Type type, const Color& color, size_t first, size_t count)
+{
+    Command command = {};
+    command.type = type;
+    command.key = m_sortKey;
+    command.color = { .r = color.getRed(), .g = color.getGreen(), .b = color.getBlue(), .a = color.getAlpha() };
+    command.first = static_cast<uint32_t>(first);
+    command.count = static_cast<uint32_t>(count);
+    m_commands.push_back(command);
+}
+
+void RenderCommandList::recordRectangle(const AbstractRectangle& rectangle, Command::Type type)
+{
+    const size_t first = m_rects.size();
+    m_rects.push_back({ .x = static_cast<float>(rectangle.m_rect.x), .y = static_cast<float>(rectangle.m_rect.y),
+                        .w = static_cast<float>(rectangle.m_rect.w), .h = static_cast<float>(rectangle.m_rect.h) });
+    push(type, rectangle.m_color, first, 1);
+}
+
+void RenderCommandList::recordRectangle(const AbstractRectanglef& rectangle, Command::Type type)
+{
+    const size_t first = m_rects.size();
+    m_rects.push_back(rectangle.m_rect);
+    push(type, rectangle.m_color, first, 1);
+}
+
+void RenderCommandList::recordRectangles(const AbstractRectangleArray& rectangles, Command::Type type)
+{
+    const size_t first = m_rects.size();
+    for(const SDL_Rect& rect : rectangles.m_rects)
+        m_rects.push_back({ .x = static_cast<float>(rect.x), .y = static_cast<float>(rect.y),
+                            .w = static_cast<float>(rect.w), .h = static_cast<float>(rect.h) });
+    push(type, rectangles.m_color, first, rectangles.m_rects.size());
+}
+
+void RenderCommandList::recordRectangles(const AbstractRectangleArrayf& rectangles, Command::Type type)
+{
+    const size_t first = m_rects.size();
+    m_rects.insert(m_rects.end(), rectangles.m_rects.begin(), rectangles.m_rects.end());
+    push(type, rectangles.m_color, first, rectangles.m_rects.size());
+}
+}
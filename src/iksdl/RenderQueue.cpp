@@ -0,0 +1,145 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/RenderQueue.hpp"
+#include "iksdl/Renderer.hpp"
+#include "iksdl/JobSystem.hpp"
+#include "iksdl/InvalidParameterException.hpp"
+#include <string>
+#include <utility>
+
+namespace iksdl
+{
+RenderQueue::RenderQueue(size_t listsCount) :
+    m_lists(listsCount),
+    m_recording(listsCount),
+    m_closed(false)
+{
+    if(listsCount < 2 || listsCount > 3)
+        throw InvalidParameterException(std::string(LISTS_COUNT_ERROR));
+
+    // Record the lists in order, so the first one is at the back
+    for(size_t i = listsCount ; i > 0 ; --i)
+        m_free.push_back(i - 1);
+}
+
+RenderCommandList* RenderQueue::beginRecording()
+{
+    std::unique_lock lock(m_mutex);
+
+    // A list that was not submitted is recorded again
+    if(m_recording == m_lists.size())
+    {
+        m_freed.wait(lock, [this] { return m_closed || !m_free.empty(); });
+        if(m_closed)
+            return nullptr;
+
+        m_recording = m_free.back();
+        m_free.pop_back();
+    }
+
+    RenderCommandList& list = m_lists[m_recording];
+    lock.unlock();
+
+    list.reset();
+    return &list;
+}
+
+void RenderQueue::recordParallel(size_t buffersCount, const std::function<void(size_t, RenderCommandList&)>& recorder)
+{
+    RenderCommandList* list = nullptr;
+    {
+        std::scoped_lock lock(m_mutex);
+
+        if(m_recording == m_lists.size())
+            return;
+
+        list = &m_lists[m_recording];
+    }
+
+    m_buffers.resize(buffersCount);
+
+    JobSystem::parallelFor(0, buffersCount, [this, &recorder](size_t begin, size_t end)
+    {
+        for(size_t i = begin ; i < end ; ++i)
+        {
+            m_buffers[i].reset();
+            recorder(i, m_buffers[i]);
+        }
+    });
+
+    list->merge(m_buffers);
+}
+
+void RenderQueue::submit()
+{
+    {
+        std::scoped_lock lock(m_mutex);
+
+        if(m_recording == m_lists.size())
+            return;
+
+        m_submitted.push_back(std::exchange(m_recording, m_lists.size()));
+    }
+
+    m_filled.notify_one();
+}
+
+bool RenderQueue::execute(Renderer& renderer, std::chrono::nanoseconds timeout)
+{
+    std::unique_lock lock(m_mutex);
+
+    if(!m_filled.wait_for(lock, timeout, [this] { return m_closed || !m_submitted.empty(); }) || m_closed)
+        return false;
+
+    const size_t index = m_submitted.front();
+    m_submitted.pop_front();
+    lock.unlock();
+
+    // Only this thread uses the list until it is freed
+    renderer.draw(m_lists[index]);
+
+    lock.lock();
+    m_free.push_back(index);
+    lock.unlock();
+
+    m_freed.notify_one();
+    return true;
+}
+
+void RenderQueue::close()
+{
+    {
+        std::scoped_lock lock(m_mutex);
+        m_closed = true;
+    }
+
+    m_freed.notify_all();
+    m_filled.notify_all();
+}
+
+size_t RenderQueue::getPendingCount() const
+{
+    std::scoped_lock lock(m_mutex);
+    return m_submitted.size();
+}
+}
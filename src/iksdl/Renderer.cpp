@@ -28,16 +28,22 @@
 namespace iksdl
 {
 Renderer::Renderer(SDL_Window& window, const RendererOptions& options) :
-    m_renderer(nullptr)
+    m_renderer(nullptr),
+    m_software(false)
 {
     m_renderer = SDL_CreateRenderer(&window, -1, options.m_sdlFlags);
     if(m_renderer == nullptr)
         throw SdlException(std::string(CREATE_RENDERER_ERROR) + SDL_GetError());
+
+    SDL_RendererInfo info;
+    if(SDL_GetRendererInfo(m_renderer, &info) == 0)
+        m_software = (info.flags & SDL_RENDERER_SOFTWARE) != 0;
 }
 
 Renderer::Renderer(Renderer&& other) :
     m_renderer(std::exchange(other.m_renderer, nullptr)),
-    m_viewport(std::move(other.m_viewport))
+    m_viewport(std::move(other.m_viewport)),
+    m_software(other.m_software)
 {}
 
 Renderer::~Renderer()
@@ -53,6 +59,7 @@ Renderer& Renderer::operator=(Renderer&& other)
     SDL_DestroyRenderer(m_renderer);
     m_renderer = std::exchange(other.m_renderer, nullptr);
     m_viewport = std::move(other.m_viewport);
+    m_software = other.m_software;
 
     return *this;
 }
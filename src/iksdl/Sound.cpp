@@ -22,28 +22,43 @@
 
 #include "iksdl/Sound.hpp"
 #include "iksdl/InvalidParameterException.hpp"
+#include "iksdl/Initializer.hpp"
+#include <utility>
 
 namespace iksdl
 {
-Sound::Sound(const std::string& filePath) :
-    m_channels(priv::Channels::getInstance()),
+Sound::Sound(const std::string& filePath, const SoundPolicy& policy) :
     m_chunk(nullptr),
-    m_channel(std::nullopt)
+    m_voiceGroup(priv::Voices::getInstance()->createGroup(policy)),
+    m_lastVoice()
 {
+    priv::Initializer* initializer = priv::Initializer::getInstance();
+    initializer->acquire(Subsystems::Type::Audio);
+
     m_chunk = Mix_LoadWAV(filePath.c_str());
 
     if(m_chunk == nullptr)
-        throw InvalidParameterException("Failed to load sound from path " + filePath + ". Cause: " + Mix_GetError());
+    {
+        const std::string error = Mix_GetError();
+        initializer->release(Subsystems::Type::Audio);
+        throw InvalidParameterException("Failed to load sound from path " + filePath + ". Cause: " + error);
+    }
 }
 
 Sound::Sound(Sound&& other) :
-    m_chunk(std::exchange(m_chunk, other.m_chunk)),
-    m_channel(std::exchange(m_channel, other.m_channel))
-{}
+    m_chunk(std::exchange(other.m_chunk, nullptr)),
+    m_voiceGroup(other.m_voiceGroup),
+    m_lastVoice(std::exchange(other.m_lastVoice, Voice()))
+{
+    // the moved sound must not stop the voices it gave away
+    other.m_voiceGroup.id = 0;
+}
 
 Sound::~Sound()
 {
-    Mix_FreeChunk(m_chunk);
+    // the chunk must not be played anymore when it is freed
+    priv::Voices::getInstance()->stopGroup(m_voiceGroup);
+    free();
 }
 
 Sound& Sound::operator=(Sound&& other)
@@ -51,25 +66,61 @@ Sound& Sound::operator=(Sound&& other)
     if(this == &other)
         return *this;
 
-    Mix_FreeChunk(m_chunk);
-    m_chunk = std::exchange(m_chunk, other.m_chunk);
+    priv::Voices::getInstance()->stopGroup(m_voiceGroup);
+    free();
 
-    m_channel = std::exchange(m_channel, other.m_channel);
+    m_chunk = std::exchange(other.m_chunk, nullptr);
+    m_voiceGroup = other.m_voiceGroup;
+    m_lastVoice = std::exchange(other.m_lastVoice, Voice());
+    other.m_voiceGroup.id = 0;
 
     return *this;
 }
 
-void Sound::play(int loops)
+Voice Sound::play(int loops)
+{
+    return play(std::chrono::milliseconds(-1), loops);
+}
+
+Voice Sound::play(std::chrono::milliseconds time, int loops)
+{
+    priv::Voices* voices = priv::Voices::getInstance();
+
+    const int channel = voices->start(m_voiceGroup, m_chunk, loops, static_cast<int>(time.count()));
+    if(channel < 0)
+        return Voice();
+
+    m_lastVoice = Voice(channel, voices->getSerial(channel));
+    return m_lastVoice;
+}
+
+void Sound::stop()
+{
+    priv::Voices::getInstance()->stopGroup(m_voiceGroup);
+}
+
+void Sound::setVolume(int volume) const
+{
+    if(m_chunk == nullptr)
+        return;
+
+    // the mixing engine keeps the volume of the sound in its voices
+    Mix_VolumeChunk(m_chunk, volume);
+    priv::Voices::getInstance()->setChunkVolume(m_voiceGroup, m_chunk->volume);
+}
+
+void Sound::pauseAll()
 {
-    const int channel = m_channels->reserve();
-    m_channel = channel;
-    Mix_PlayChannel(channel, m_chunk, loops);
+    priv::Voices::getInstance()->pauseAll();
 }
 
-void Sound::play(std::chrono::milliseconds time, int loops)
+void Sound::free()
 {
-    const int channel = m_channels->reserve();
-    m_channel = channel;
-    Mix_PlayChannelTimed(channel, m_chunk, loops, static_cast<int>(time.count()));
+    // A moved sound does not use the audio device anymore
+    if(m_chunk == nullptr)
+        return;
+
+    Mix_FreeChunk(m_chunk);
+    priv::Initializer::getInstance()->release(Subsystems::Type::Audio);
 }
 }
@@ -0,0 +1,56 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/SoundBank.hpp"
+#include "iksdl/InvalidParameterException.hpp"
+
+namespace iksdl
+{
+Sound& SoundBank::load(const std::string& name, const std::string& filePath, const SoundPolicy& policy)
+{
+    const auto found = m_sounds.find(name);
+    if(found != m_sounds.end())
+        return found->second;
+
+    return m_sounds.emplace(name, Sound(filePath, policy)).first->second;
+}
+
+void SoundBank::unload(const std::string& name)
+{
+    m_sounds.erase(name);
+}
+
+Sound& SoundBank::get(const std::string& name)
+{
+    const auto found = m_sounds.find(name);
+    if(found == m_sounds.end())
+        throw InvalidParameterException("No sound named " + name + " in the sound bank");
+
+    return found->second;
+}
+
+void SoundBank::stopAll()
+{
+    for(auto& [name, sound] : m_sounds)
+        sound.stop();
+}
+}
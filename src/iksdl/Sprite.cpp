@@ -22,6 +22,7 @@
 
 #include "iksdl/Sprite.hpp"
 #include "iksdl/Texture.hpp"
+#include "iksdl/Blitter.hpp"
 
 namespace iksdl
 {
@@ -51,7 +52,12 @@ void Sprite::scale(const Sizef& delta)
 void Sprite::draw(SDL_Renderer* const renderer) const
 {
     if(m_rotation == 0.0 && m_flip == SDL_FLIP_NONE)
-        SDL_RenderCopy(renderer, m_texture->m_texture, m_textureRectPtr, &m_rect);
+    {
+        // Software rendering uses the vectorized blitter when possible
+        if(m_texture->m_pixels == nullptr ||
+           !priv::Blitter::getInstance().blit(renderer, m_texture->m_texture, *m_texture->m_pixels, m_textureRectPtr, m_rect))
+            SDL_RenderCopy(renderer, m_texture->m_texture, m_textureRectPtr, &m_rect);
+    }
     else
         SDL_RenderCopyEx(renderer, m_texture->m_texture, m_textureRectPtr, &m_rect, m_rotation, m_centerPtr, m_flip);
 }
@@ -0,0 +1,122 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/SpriteSheet.hpp"
+#include "iksdl/Texture.hpp"
+#include "iksdl/InvalidParameterException.hpp"
+
+namespace iksdl
+{
+SpriteSheet::SpriteSheet(const Texture& texture) :
+    m_texture(&texture)
+{}
+
+SpriteSheet& SpriteSheet::addFrame(const Recti& rect)
+{
+    const Sizei& textureSize = m_texture->getSize();
+    if(rect.getWidth() <= 0 || rect.getHeight() <= 0 || rect.getX() < 0 || rect.getY() < 0 ||
+       rect.getX() + rect.getWidth() > textureSize.getWidth() || rect.getY() + rect.getHeight() > textureSize.getHeight())
+        throw InvalidParameterException("Sprite sheet frame is empty or outside of the texture");
+
+    // The normalized coordinates are computed once, so that animating only copies them
+    const float textureWidth = static_cast<float>(textureSize.getWidth());
+    const float textureHeight = static_cast<float>(textureSize.getHeight());
+    m_frames.push_back(Frame { .rect = { .x = rect.getX(), .y = rect.getY(), .w = rect.getWidth(), .h = rect.getHeight() },
+                               .uv = { .x = static_cast<float>(rect.getX()) / textureWidth,
+                                       .y = static_cast<float>(rect.getY()) / textureHeight,
+                                       .w = static_cast<float>(rect.getWidth()) / textureWidth,
+                                       .h = static_cast<float>(rect.getHeight()) / textureHeight } });
+    return *this;
+}
+
+SpriteSheet& SpriteSheet::addGrid(const Sizei& frameSize)
+{
+    const Sizei& textureSize = m_texture->getSize();
+    if(frameSize.getWidth() <= 0 || frameSize.getHeight() <= 0 ||
+       frameSize.getWidth() > textureSize.getWidth() || frameSize.getHeight() > textureSize.getHeight())
+        throw InvalidParameterException("Sprite sheet grid frames are empty or larger than the texture");
+
+    const int columns = textureSize.getWidth() / frameSize.getWidth();
+    const int rows = textureSize.getHeight() / frameSize.getHeight();
+    m_frames.reserve(m_frames.size() + static_cast<size_t>(columns * rows));
+
+    for(int row = 0 ; row < rows ; ++row)
+    {
+        for(int column = 0 ; column < columns ; ++column)
+            addFrame(Recti(column * frameSize.getWidth(), row * frameSize.getHeight(), frameSize.getWidth(), frameSize.getHeight()));
+    }
+
+    return *this;
+}
+
+SpriteSheet& SpriteSheet::addAnimation(const std::string& name, const std::vector<size_t>& frames,
+                                       std::chrono::nanoseconds frameDuration, bool loop)
+{
+    std::vector<std::pair<size_t, std::chrono::nanoseconds>> timedFrames;
+    timedFrames.reserve(frames.size());
+
+    for(size_t frame : frames)
+        timedFrames.emplace_back(frame, frameDuration);
+
+    return addAnimation(name, timedFrames, loop);
+}
+
+SpriteSheet& SpriteSheet::addAnimation(const std::string& name,
+                                       const std::vector<std::pair<size_t, std::chrono::nanoseconds>>& frames, bool loop)
+{
+    if(m_names.contains(name))
+        throw InvalidParameterException("Sprite sheet already has an animation named " + name);
+
+    if(frames.empty())
+        throw InvalidParameterException("Sprite sheet animation " + name + " has no frames");
+
+    // Validate all the frames before changing the sheet
+    for(const auto& [frame, duration] : frames)
+    {
+        if(frame >= m_frames.size() || duration.count() <= 0)
+            throw InvalidParameterException("Sprite sheet animation " + name + " has an unknown frame or a duration that is not positive");
+    }
+
+    // Each step stores its end time, so that the current step can be found from the elapsed time
+    Animation animation = { .first = static_cast<uint32_t>(m_steps.size()), .count = static_cast<uint32_t>(frames.size()),
+                            .duration = 0, .loop = loop };
+
+    for(const auto& [frame, duration] : frames)
+    {
+        animation.duration += duration.count();
+        m_steps.push_back(Step { .frame = static_cast<uint32_t>(frame), .end = animation.duration });
+    }
+
+    m_names.emplace(name, m_animations.size());
+    m_animations.push_back(animation);
+    return *this;
+}
+
+size_t SpriteSheet::getAnimation(const std::string& name) const
+{
+    const auto it = m_names.find(name);
+    if(it == m_names.end())
+        throw InvalidParameterException("Sprite sheet has no animation named " + name);
+
+    return it->second;
+}
+}
@@ -22,6 +22,7 @@
 
 #include "iksdl/Spritef.hpp"
 #include "iksdl/Texture.hpp"
+#include "iksdl/Blitter.hpp"
 
 namespace iksdl
 {
@@ -51,7 +52,14 @@ void Spritef::scale(const Sizef& delta)
 void Spritef::draw(SDL_Renderer* const renderer) const
 {
     if(m_rotation == 0.0 && m_flip == SDL_FLIP_NONE)
-        SDL_RenderCopyF(renderer, m_texture->m_texture, m_textureRectPtr, &m_rect);
+    {
+        // Software rendering uses the vectorized blitter when possible, with the same rounding as SDL
+        if(m_texture->m_pixels == nullptr ||
+           !priv::Blitter::getInstance().blit(renderer, m_texture->m_texture, *m_texture->m_pixels, m_textureRectPtr,
+                                              SDL_Rect { .x = static_cast<int>(m_rect.x), .y = static_cast<int>(m_rect.y),
+                                                         .w = static_cast<int>(m_rect.w), .h = static_cast<int>(m_rect.h) }))
+            SDL_RenderCopyF(renderer, m_texture->m_texture, m_textureRectPtr, &m_rect);
+    }
     else
         SDL_RenderCopyExF(renderer, m_texture->m_texture, m_textureRectPtr, &m_rect, m_rotation, m_centerPtr, m_flip);
 }
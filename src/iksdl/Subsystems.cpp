@@ -0,0 +1,46 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/Subsystems.hpp"
+#include "iksdl/Initializer.hpp"
+
+namespace iksdl
+{
+bool Subsystems::isInitialized(Type type)
+{
+    return priv::Initializer::getInstance()->isInitialized(type);
+}
+
+std::chrono::nanoseconds Subsystems::getInitDuration(Type type)
+{
+    return priv::Initializer::getInstance()->getDuration(type);
+}
+
+std::chrono::nanoseconds Subsystems::getTotalInitDuration()
+{
+    std::chrono::nanoseconds total(0);
+    for(Type type : {Type::Video, Type::Audio, Type::Fonts, Type::PngCodec, Type::JpgCodec, Type::TifCodec, Type::WebpCodec})
+        total += getInitDuration(type);
+
+    return total;
+}
+}
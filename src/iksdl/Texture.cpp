@@ -24,16 +24,48 @@
 #include "iksdl/Window.hpp"
 #include "iksdl/InvalidParameterException.hpp"
 #include "iksdl/SdlException.hpp"
+#include "iksdl/Initializer.hpp"
 #include <SDL_image.h>
 
 namespace iksdl
 {
+namespace
+{
+/////////////////////////////////////////////////
+/// \brief Open an image file, with the codec needed to decode it
+///
+/// \param filePath Path to image file
+///
+/// \return Stream to decode, nullptr if the file could not be opened
+/////////////////////////////////////////////////
+SDL_RWops* openImage(const std::string& filePath)
+{
+    SDL_RWops* const stream = SDL_RWFromFile(filePath.c_str(), "rb");
+    if(stream != nullptr)
+        priv::Initializer::getInstance()->prepareCodec(stream);
+
+    return stream;
+}
+}
+
 Texture::Texture(const Renderer& renderer, const std::string& filePath) :
     m_texture(nullptr),
-    m_size(0, 0)
+    m_size(0, 0),
+    m_pixels(nullptr)
 {
+    // The software renderer needs the image in memory, to draw it with the vectorized blitter
+    if(renderer.m_software)
+    {
+        SDL_Surface* const surface = decode(filePath);
+        if(surface == nullptr)
+            throw SdlException("Failed to create texture from path " + filePath + ". Cause: " + IMG_GetError());
+
+        createFromSurface(renderer, surface, filePath);
+        return;
+    }
+
     // Load the image in GPU
-    m_texture = IMG_LoadTexture(renderer.m_renderer, filePath.c_str());
+    m_texture = IMG_LoadTexture_RW(renderer.m_renderer, openImage(filePath), 1);
     if(m_texture == nullptr)
         throw SdlException("Failed to create texture from path " + filePath + ". Cause: " + SDL_GetError());
 
@@ -44,36 +76,38 @@ Texture::Texture(const Renderer& renderer, const std::string& filePath) :
 
 Texture::Texture(const Renderer& renderer, const std::string& filePath, const Color& colorKey) :
     m_texture(nullptr),
-    m_size(0, 0)
+    m_size(0, 0),
+    m_pixels(nullptr)
 {
     // Load the image in memory
-    SDL_Surface* const surface = IMG_Load(filePath.c_str());
+    SDL_Surface* const surface = decode(filePath);
     if(surface == nullptr)
         throw InvalidParameterException("Unable to load image at path " + filePath + ". Cause: " + IMG_GetError());
 
-    m_size = Sizei(surface->w, surface->h);
-
     // Color key the image
     SDL_SetColorKey(surface, SDL_TRUE, SDL_MapRGB(surface->format, colorKey.getRed(), colorKey.getGreen(), colorKey.getBlue()));
 
-    // Load the image from memory to GPU
-    m_texture = SDL_CreateTextureFromSurface(renderer.m_renderer, surface);
-
-    // Free the image from memory
-    SDL_FreeSurface(surface);
+    createFromSurface(renderer, surface, filePath);
+}
 
-    if(m_texture == nullptr)
-        throw SdlException("Failed to create texture for image from path " + filePath + ". Cause: " + SDL_GetError());
+Texture::Texture(const Renderer& renderer, SDL_Surface* surface, const std::string& filePath) :
+    m_texture(nullptr),
+    m_size(0, 0),
+    m_pixels(nullptr)
+{
+    createFromSurface(renderer, surface, filePath);
 }
 
 Texture::Texture(Texture&& other) :
     m_texture(std::exchange(other.m_texture, nullptr)),
-    m_size(other.m_size)
+    m_size(other.m_size),
+    m_pixels(std::exchange(other.m_pixels, nullptr))
 {}
 
 Texture::~Texture()
 {
     SDL_DestroyTexture(m_texture);
+    SDL_FreeSurface(m_pixels);
 }
 
 Texture& Texture::operator=(Texture&& other)
@@ -83,7 +117,37 @@ Texture& Texture::operator=(Texture&& other)
 
     SDL_DestroyTexture(m_texture);
     m_texture = std::exchange(other.m_texture, nullptr);
+    m_size = other.m_size;
+
+    SDL_FreeSurface(m_pixels);
+    m_pixels = std::exchange(other.m_pixels, nullptr);
 
     return *this;
 }
+
+SDL_Surface* Texture::decode(const std::string& filePath)
+{
+    return IMG_Load_RW(openImage(filePath), 1);
+}
+
+void Texture::createFromSurface(const Renderer& renderer, SDL_Surface* surface, const std::string& filePath)
+{
+    m_size = Sizei(surface->w, surface->h);
+
+    // Keep a copy of the image in memory for the software renderer
+    if(renderer.m_software)
+        m_pixels = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+
+    // Load the image from memory to GPU
+    m_texture = SDL_CreateTextureFromSurface(renderer.m_renderer, m_pixels != nullptr ? m_pixels : surface);
+
+    // Free the image from memory
+    SDL_FreeSurface(surface);
+
+    if(m_texture == nullptr)
+    {
+        SDL_FreeSurface(std::exchange(m_pixels, nullptr));
+        throw SdlException("Failed to create texture for image from path " + filePath + ". Cause: " + SDL_GetError());
+    }
+}
 }
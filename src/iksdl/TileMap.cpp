@@ -0,0 +1,338 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/TileMap.hpp"
+#include "iksdl/Texture.hpp"
+#include "iksdl/InvalidParameterException.hpp"
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <utility>
+
+namespace iksdl
+{
+TileMap::TileMap(const Texture& tileset, const Sizei& tileSize, const Sizei& mapSize, const Sizei& chunkSize) :
+    m_tileset(&tileset),
+    m_tileSize(tileSize),
+    m_mapSize(mapSize),
+    m_chunkSize(chunkSize),
+    m_chunksCount(0, 0),
+    m_tilesCount(0),
+    m_tilesetColumns(0),
+    m_position(0.f, 0.f),
+    m_cacheSize(DEFAULT_CACHE_SIZE),
+    m_frame(0)
+{
+    const Sizei& tilesetSize = tileset.getSize();
+    if(tileSize.getWidth() <= 0 || tileSize.getHeight() <= 0 || mapSize.getWidth() <= 0 || mapSize.getHeight() <= 0 ||
+       chunkSize.getWidth() <= 0 || chunkSize.getHeight() <= 0)
+        throw InvalidParameterException("Tile map sizes must be positive");
+
+    if(tileSize.getWidth() > tilesetSize.getWidth() || tileSize.getHeight() > tilesetSize.getHeight())
+        throw InvalidParameterException("Tile map tiles are larger than the tileset");
+
+    m_tilesetColumns = tilesetSize.getWidth() / tileSize.getWidth();
+    m_tilesCount = static_cast<uint16_t>(std::min(m_tilesetColumns * (tilesetSize.getHeight() / tileSize.getHeight()),
+                                                  static_cast<int>(EMPTY_TILE)));
+
+    m_chunksCount = Sizei((mapSize.getWidth() + chunkSize.getWidth() - 1) / chunkSize.getWidth(),
+                          (mapSize.getHeight() + chunkSize.getHeight() - 1) / chunkSize.getHeight());
+
+    m_tiles.assign(static_cast<size_t>(mapSize.getWidth()) * static_cast<size_t>(mapSize.getHeight()), EMPTY_TILE);
+    m_chunks.resize(static_cast<size_t>(m_chunksCount.getWidth()) * static_cast<size_t>(m_chunksCount.getHeight()),
+                    Chunk { .texture = nullptr, .vertices = {}, .lastDrawn = 0, .cached = false, .upToDate = false });
+
+    // All the chunks share the same triangles, since their quads are packed
+    const int quads = chunkSize.getWidth() * chunkSize.getHeight();
+    m_indices.reserve(static_cast<size_t>(quads) * 6);
+    for(int quad = 0 ; quad < quads ; ++quad)
+    {
+        const int base = quad * 4;
+        m_indices.insert(m_indices.end(), { base, base + 1, base + 2, base, base + 2, base + 3 });
+    }
+}
+
+TileMap::TileMap(TileMap&& other) :
+    m_tileset(other.m_tileset),
+    m_tileSize(other.m_tileSize),
+    m_mapSize(other.m_mapSize),
+    m_chunkSize(other.m_chunkSize),
+    m_chunksCount(other.m_chunksCount),
+    m_tilesCount(other.m_tilesCount),
+    m_tilesetColumns(other.m_tilesetColumns),
+    m_position(other.m_position),
+    m_tiles(std::move(other.m_tiles)),
+    m_indices(std::move(other.m_indices)),
+    m_cacheSize(other.m_cacheSize),
+    m_chunks(std::move(other.m_chunks)),
+    m_cached(std::move(other.m_cached)),
+    m_scratch(std::move(other.m_scratch)),
+    m_frame(other.m_frame)
+{
+    other.m_chunks.clear();
+    other.m_cached.clear();
+}
+
+TileMap::~TileMap()
+{
+    for(Chunk& chunk : m_chunks)
+        release(chunk);
+}
+
+void TileMap::setTile(const Positioni& cell, uint16_t tile)
+{
+    if(cell.getX() < 0 || cell.getY() < 0 || cell.getX() >= m_mapSize.getWidth() || cell.getY() >= m_mapSize.getHeight())
+        throw InvalidParameterException("Tile map cell is outside of the map");
+
+    if(tile >= m_tilesCount && tile != EMPTY_TILE)
+        throw InvalidParameterException("Tile map tileset has no tile " + std::to_string(tile));
+
+    uint16_t& current = m_tiles[static_cast<size_t>(cell.getY()) * static_cast<size_t>(m_mapSize.getWidth()) + static_cast<size_t>(cell.getX())];
+    if(current == tile)
+        return;
+
+    // Only the chunk containing the cell is drawn again
+    current = tile;
+    m_chunks[static_cast<size_t>(cell.getY() / m_chunkSize.getHeight()) * static_cast<size_t>(m_chunksCount.getWidth()) +
+             static_cast<size_t>(cell.getX() / m_chunkSize.getWidth())].upToDate = false;
+}
+
+void TileMap::setTiles(const std::vector<uint16_t>& tiles)
+{
+    if(tiles.size() != m_tiles.size())
+        throw InvalidParameterException("Tile map needs " + std::to_string(m_tiles.size()) + " tiles");
+
+    if(std::any_of(tiles.begin(), tiles.end(), [this](uint16_t tile) { return tile >= m_tilesCount && tile != EMPTY_TILE; }))
+        throw InvalidParameterException("Tile map tileset does not have all the tiles");
+
+    m_tiles = tiles;
+    invalidate();
+}
+
+void TileMap::setCacheSize(size_t chunks)
+{
+    m_cacheSize = chunks;
+
+    // Drop the least recently drawn chunks that do not fit anymore
+    std::sort(m_cached.begin(), m_cached.end(), [this](size_t a, size_t b) { return m_chunks[a].lastDrawn > m_chunks[b].lastDrawn; });
+    while(m_cached.size() > m_cacheSize)
+    {
+        release(m_chunks[m_cached.back()]);
+        m_cached.pop_back();
+    }
+}
+
+void TileMap::invalidate()
+{
+    for(Chunk& chunk : m_chunks)
+        chunk.upToDate = false;
+}
+
+void TileMap::draw(SDL_Renderer* const renderer) const
+{
+    m_frame++;
+
+    // Only the chunks intersecting the viewport are drawn
+    SDL_Rect viewport;
+    SDL_RenderGetViewport(renderer, &viewport);
+
+    const float chunkWidth = static_cast<float>(m_chunkSize.getWidth() * m_tileSize.getWidth());
+    const float chunkHeight = static_cast<float>(m_chunkSize.getHeight() * m_tileSize.getHeight());
+    const int firstColumn = std::max(static_cast<int>(std::floor(-m_position.getX() / chunkWidth)), 0);
+    const int firstRow = std::max(static_cast<int>(std::floor(-m_position.getY() / chunkHeight)), 0);
+    const int endColumn = std::min(static_cast<int>(std::ceil((static_cast<float>(viewport.w) - m_position.getX()) / chunkWidth)),
+                                   m_chunksCount.getWidth());
+    const int endRow = std::min(static_cast<int>(std::ceil((static_cast<float>(viewport.h) - m_position.getY()) / chunkHeight)),
+                                m_chunksCount.getHeight());
+
+    const bool targets = SDL_RenderTargetSupported(renderer) == SDL_TRUE;
+
+    for(int row = firstRow ; row < endRow ; ++row)
+    {
+        for(int column = firstColumn ; column < endColumn ; ++column)
+        {
+            const size_t index = static_cast<size_t>(row) * static_cast<size_t>(m_chunksCount.getWidth()) + static_cast<size_t>(column);
+            Chunk& chunk = m_chunks[index];
+            chunk.lastDrawn = m_frame;
+
+            const SDL_FPoint offset = { .x = m_position.getX() + static_cast<float>(column) * chunkWidth,
+                                        .y = m_position.getY() + static_cast<float>(row) * chunkHeight };
+
+            // A chunk that cannot be cached is drawn directly from its tiles
+            if(!chunk.upToDate && !chunk.cached && !reserveCache())
+            {
+                buildChunk(index, m_scratch);
+                drawGeometry(renderer, offset);
+                continue;
+            }
+
+            // The chunks on the right and bottom borders may be smaller
+            const int width = std::min(m_chunkSize.getWidth(), m_mapSize.getWidth() - column * m_chunkSize.getWidth()) * m_tileSize.getWidth();
+            const int height = std::min(m_chunkSize.getHeight(), m_mapSize.getHeight() - row * m_chunkSize.getHeight()) * m_tileSize.getHeight();
+
+            if(!chunk.upToDate)
+            {
+                if(!chunk.cached)
+                {
+                    chunk.cached = true;
+                    m_cached.push_back(index);
+                }
+
+                if(targets && chunk.texture == nullptr)
+                {
+                    chunk.texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, width, height);
+                    SDL_SetTextureBlendMode(chunk.texture, SDL_BLENDMODE_BLEND);
+                }
+
+                if(chunk.texture != nullptr)
+                    bake(renderer, index);
+                else
+                    buildChunk(index, chunk.vertices);
+
+                chunk.upToDate = true;
+            }
+
+            if(chunk.texture != nullptr)
+            {
+                const SDL_FRect destination = { .x = offset.x, .y = offset.y, .w = static_cast<float>(width), .h = static_cast<float>(height) };
+                SDL_RenderCopyF(renderer, chunk.texture, nullptr, &destination);
+            }
+            else
+            {
+                m_scratch.assign(chunk.vertices.begin(), chunk.vertices.end());
+                drawGeometry(renderer, offset);
+            }
+        }
+    }
+}
+
+void TileMap::bake(SDL_Renderer* renderer, size_t chunk) const
+{
+    buildChunk(chunk, m_scratch);
+
+    // The tiles do not overlap, so they are copied without blending to keep their transparency
+    SDL_Texture* const previousTarget = SDL_GetRenderTarget(renderer);
+    SDL_BlendMode tilesetBlending;
+    SDL_GetTextureBlendMode(m_tileset->m_texture, &tilesetBlending);
+    SDL_SetTextureBlendMode(m_tileset->m_texture, SDL_BLENDMODE_NONE);
+
+    // The chunk is cleared to transparent, the color of the next drawings must not change
+    Uint8 red, green, blue, alpha;
+    SDL_GetRenderDrawColor(renderer, &red, &green, &blue, &alpha);
+
+    SDL_SetRenderTarget(renderer, m_chunks[chunk].texture);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    if(!m_scratch.empty())
+        SDL_RenderGeometry(renderer, m_tileset->m_texture, m_scratch.data(), static_cast<int>(m_scratch.size()),
+                           m_indices.data(), static_cast<int>(m_scratch.size() / 4 * 6));
+    SDL_SetRenderTarget(renderer, previousTarget);
+
+    SDL_SetRenderDrawColor(renderer, red, green, blue, alpha);
+
+    SDL_SetTextureBlendMode(m_tileset->m_texture, tilesetBlending);
+}
+
+void TileMap::buildChunk(size_t chunk, std::vector<SDL_Vertex>& vertices) const
+{
+    vertices.clear();
+
+    const int firstColumn = static_cast<int>(chunk % static_cast<size_t>(m_chunksCount.getWidth())) * m_chunkSize.getWidth();
+    const int firstRow = static_cast<int>(chunk / static_cast<size_t>(m_chunksCount.getWidth())) * m_chunkSize.getHeight();
+    const int endColumn = std::min(firstColumn + m_chunkSize.getWidth(), m_mapSize.getWidth());
+    const int endRow = std::min(firstRow + m_chunkSize.getHeight(), m_mapSize.getHeight());
+
+    const float tileWidth = static_cast<float>(m_tileSize.getWidth());
+    const float tileHeight = static_cast<float>(m_tileSize.getHeight());
+    const float uvWidth = tileWidth / static_cast<float>(m_tileset->getSize().getWidth());
+    const float uvHeight = tileHeight / static_cast<float>(m_tileset->getSize().getHeight());
+    const SDL_Color white = { .r = 255, .g = 255, .b = 255, .a = 255 };
+
+    // Only the cells with a tile get a quad
+    for(int row = firstRow ; row < endRow ; ++row)
+    {
+        const uint16_t* const tiles = m_tiles.data() + static_cast<size_t>(row) * static_cast<size_t>(m_mapSize.getWidth());
+        const float y = static_cast<float>(row - firstRow) * tileHeight;
+
+        for(int column = firstColumn ; column < endColumn ; ++column)
+        {
+            const uint16_t tile = tiles[column];
+            if(tile == EMPTY_TILE)
+                continue;
+
+            const float x = static_cast<float>(column - firstColumn) * tileWidth;
+            const float u = static_cast<float>(tile % m_tilesetColumns) * uvWidth;
+            const float v = static_cast<float>(tile / m_tilesetColumns) * uvHeight;
+
+            vertices.push_back({ .position = { .x = x, .y = y }, .color = white, .tex_coord = { .x = u, .y = v } });
+            vertices.push_back({ .position = { .x = x + tileWidth, .y = y }, .color = white, .tex_coord = { .x = u + uvWidth, .y = v } });
+            vertices.push_back({ .position = { .x = x + tileWidth, .y = y + tileHeight }, .color = white,
+                                 .tex_coord = { .x = u + uvWidth, .y = v + uvHeight } });
+            vertices.push_back({ .position = { .x = x, .y = y + tileHeight }, .color = white, .tex_coord = { .x = u, .y = v + uvHeight } });
+        }
+    }
+}
+
+bool TileMap::reserveCache() const
+{
+    if(m_cached.size() < m_cacheSize)
+        return true;
+
+    // Evict the least recently drawn chunk, unless it is visible in this frame
+    const auto oldest = std::min_element(m_cached.begin(), m_cached.end(),
+                                         [this](size_t a, size_t b) { return m_chunks[a].lastDrawn < m_chunks[b].lastDrawn; });
+    if(oldest == m_cached.end() || m_chunks[*oldest].lastDrawn == m_frame)
+        return false;
+
+    release(m_chunks[*oldest]);
+    *oldest = m_cached.back();
+    m_cached.pop_back();
+    return true;
+}
+
+void TileMap::release(Chunk& chunk)
+{
+    if(chunk.texture != nullptr)
+        SDL_DestroyTexture(chunk.texture);
+
+    chunk.texture = nullptr;
+    chunk.vertices = std::vector<SDL_Vertex>();
+    chunk.cached = false;
+    chunk.upToDate = false;
+}
+
+void TileMap::drawGeometry(SDL_Renderer* renderer, const SDL_FPoint& offset) const
+{
+    if(m_scratch.empty())
+        return;
+
+    // The quads are relative to their chunk, so they are moved to the chunk position
+    for(SDL_Vertex& vertex : m_scratch)
+    {
+        vertex.position.x += offset.x;
+        vertex.position.y += offset.y;
+    }
+
+    SDL_RenderGeometry(renderer, m_tileset->m_texture, m_scratch.data(), static_cast<int>(m_scratch.size()),
+                       m_indices.data(), static_cast<int>(m_scratch.size() / 4 * 6));
+}
+}
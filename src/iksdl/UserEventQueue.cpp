@@ -0,0 +1,124 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/UserEventQueue.hpp"
+#include "iksdl/SdlException.hpp"
+#include <SDL.h>
+#include <string>
+
+namespace iksdl::priv
+{
+UserEventQueue* UserEventQueue::getInstance()
+{
+    static UserEventQueue queue;
+    return &queue;
+}
+
+UserEventQueue::UserEventQueue() :
+    m_head(&m_stub),
+    m_tail(&m_stub),
+    m_stub{ nullptr, std::any() },
+    m_wakeUpPending(false),
+    m_wakeUpType(SDL_RegisterEvents(1))
+{}
+
+UserEventQueue::~UserEventQueue()
+{
+    while(Node* node = take())
+        delete node;
+}
+
+void UserEventQueue::post(std::any&& payload)
+{
+    if(m_wakeUpType == static_cast<uint32_t>(-1))
+        throw SdlException(std::string("Could not register user events.\nCause: ") + SDL_GetError());
+
+    push(new Node{ nullptr, std::move(payload) });
+
+    // Only one wake up event is needed until the consumer handles it
+    if(!m_wakeUpPending.exchange(true, std::memory_order_seq_cst))
+    {
+        SDL_Event event{};
+        event.type = m_wakeUpType;
+
+        if(SDL_PushEvent(&event) < 0)
+        {
+            m_wakeUpPending.store(false, std::memory_order_seq_cst);
+            throw SdlException(std::string("Could not wake up the event loop.\nCause: ") + SDL_GetError());
+        }
+    }
+}
+
+UserEventQueue::Node* UserEventQueue::take()
+{
+    Node* tail = m_tail;
+    Node* next = tail->next.load(std::memory_order_acquire);
+
+    // Skip the stub, it is not a real element
+    if(tail == &m_stub)
+    {
+        if(next == nullptr)
+            return nullptr;
+
+        m_tail = next;
+        tail = next;
+        next = next->next.load(std::memory_order_acquire);
+    }
+
+    if(next != nullptr)
+    {
+        m_tail = next;
+        return tail;
+    }
+
+    // A producer is linking a new element, it will be taken next time
+    if(tail != m_head.load(std::memory_order_acquire))
+        return nullptr;
+
+    // The last element cannot be taken while it is the head, so put the stub behind it
+    push(&m_stub);
+
+    next = tail->next.load(std::memory_order_acquire);
+    if(next != nullptr)
+    {
+        m_tail = next;
+        return tail;
+    }
+
+    return nullptr;
+}
+
+std::any UserEventQueue::release(Node* node)
+{
+    std::any payload = std::move(node->payload);
+    delete node;
+
+    return payload;
+}
+
+void UserEventQueue::push(Node* node)
+{
+    node->next.store(nullptr, std::memory_order_relaxed);
+    Node* previous = m_head.exchange(node, std::memory_order_acq_rel);
+    previous->next.store(node, std::memory_order_release);
+}
+}
@@ -0,0 +1,76 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/Voice.hpp"
+#include "iksdl/Voices.hpp"
+
+namespace iksdl
+{
+void Voice::pause() const
+{
+    if(isValid())
+        priv::Voices::getInstance()->pause(m_channel);
+}
+
+void Voice::resume() const
+{
+    if(isValid())
+        priv::Voices::getInstance()->resume(m_channel);
+}
+
+void Voice::stop() const
+{
+    priv::Voices::getInstance()->stopVoice(m_channel, m_serial);
+}
+
+void Voice::setVolume(int volume) const
+{
+    if(isValid())
+        priv::Voices::getInstance()->setVolume(m_channel, volume);
+}
+
+int Voice::getVolume() const
+{
+    return isValid() ? priv::Voices::getInstance()->getVolume(m_channel) : 0;
+}
+
+void Voice::setPanning(uint8_t left, uint8_t right) const
+{
+    if(isValid())
+        priv::Voices::getInstance()->setPanning(m_channel, left, right);
+}
+
+bool Voice::isValid() const
+{
+    return priv::Voices::getInstance()->isCurrent(m_channel, m_serial);
+}
+
+bool Voice::isPlaying() const
+{
+    return isValid() && !priv::Voices::getInstance()->isPaused(m_channel);
+}
+
+bool Voice::isPaused() const
+{
+    return isValid() && priv::Voices::getInstance()->isPaused(m_channel);
+}
+}
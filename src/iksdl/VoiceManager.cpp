@@ -0,0 +1,52 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/VoiceManager.hpp"
+#include "iksdl/Voices.hpp"
+
+namespace iksdl
+{
+void VoiceManager::setMaxVoices(unsigned int voices)
+{
+    priv::Voices::getInstance()->setMaxVoices(voices);
+}
+
+unsigned int VoiceManager::getMaxVoices()
+{
+    return priv::Voices::getInstance()->getMaxVoices();
+}
+
+void VoiceManager::setStealPolicy(StealPolicy policy)
+{
+    priv::Voices::getInstance()->setStealPolicy(policy);
+}
+
+VoiceManager::StealPolicy VoiceManager::getStealPolicy()
+{
+    return priv::Voices::getInstance()->getStealPolicy();
+}
+
+size_t VoiceManager::getActiveVoicesCount()
+{
+    return priv::Voices::getInstance()->getActiveCount();
+}
+}
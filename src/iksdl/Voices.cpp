@@ -0,0 +1,332 @@
+/*
+ * IKSDL - C++ wrapper for SDL
+ * Copyright (C) 2021 InternationalKoder
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty.  In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ */
+
+#include "iksdl/Voices.hpp"
+#include "iksdl/Channels.hpp"
+#include "iksdl/Mixer.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace iksdl::priv
+{
+Voices::Voices() :
+    m_maxVoices(0),
+    m_stealPolicy(VoiceManager::StealPolicy::Oldest),
+    m_nextGroupId(1),
+    m_nextSerial(1)
+{}
+
+VoiceGroup Voices::createGroup(const SoundPolicy& policy)
+{
+    return VoiceGroup{m_nextGroupId.fetch_add(1, std::memory_order_relaxed), policy, std::chrono::steady_clock::time_point(), false};
+}
+
+int Voices::start(VoiceGroup& group, Mix_Chunk* chunk, int loops, int ticks)
+{
+    const auto now = std::chrono::steady_clock::now();
+    if(group.started && now - group.lastStart < group.policy.m_retriggerWindow)
+        return -1;
+
+    prune();
+
+    const int priority = group.policy.m_priority;
+    if(!makeRoom(group, priority))
+        return -1;
+
+    const int channel = play(chunk, loops, ticks);
+    if(channel < 0)
+        return -1;
+
+    if(static_cast<size_t>(channel) >= m_voices.size())
+        m_voices.resize(channel + 1, Voice{0, 0, 0, {}, nullptr, false});
+
+    // the channel may have been freed and reserved again since the last pruning
+    if(!m_voices[channel].active)
+        m_active.push_back(channel);
+    m_voices[channel] = Voice{m_nextSerial++, group.id, priority, now, chunk, true};
+
+    group.lastStart = now;
+    group.started = true;
+
+    return channel;
+}
+
+void Voices::stopVoice(int channel, uint64_t serial)
+{
+    if(isCurrent(channel, serial))
+        stop(channel);
+}
+
+void Voices::stopGroup(const VoiceGroup& group)
+{
+    if(group.id == 0)
+        return;
+
+    prune();
+
+    for(size_t i = m_active.size() ; i > 0 ; --i)
+    {
+        const int channel = m_active[i - 1];
+        if(m_voices[channel].group == group.id)
+            stop(channel);
+    }
+
+    // the sound of the group may be freed right after
+    Mixer::getInstance()->synchronize();
+}
+
+bool Voices::isCurrent(int channel, uint64_t serial) const
+{
+    if(channel < 0 || static_cast<size_t>(channel) >= m_voices.size())
+        return false;
+
+    const Voice& voice = m_voices[channel];
+    return voice.active && voice.serial == serial && isAlive(channel);
+}
+
+void Voices::pause(int channel)
+{
+    if(Mixer::isMixerChannel(channel))
+        Mixer::getInstance()->pause(channel);
+    else
+        Mix_Pause(channel);
+}
+
+void Voices::resume(int channel)
+{
+    if(Mixer::isMixerChannel(channel))
+        Mixer::getInstance()->resume(channel);
+    else
+        Mix_Resume(channel);
+}
+
+bool Voices::isPaused(int channel) const
+{
+    if(Mixer::isMixerChannel(channel))
+        return Mixer::getInstance()->isPaused(channel);
+
+    return Mix_Paused(channel) != 0;
+}
+
+void Voices::setVolume(int channel, int volume)
+{
+    if(Mixer::isMixerChannel(channel))
+        Mixer::getInstance()->setVolume(channel, volume);
+    else
+        Mix_Volume(channel, volume);
+}
+
+int Voices::getVolume(int channel) const
+{
+    if(Mixer::isMixerChannel(channel))
+        return Mixer::getInstance()->getVolume(channel);
+
+    return Mix_Volume(channel, -1);
+}
+
+void Voices::setPanning(int channel, uint8_t left, uint8_t right)
+{
+    if(Mixer::isMixerChannel(channel))
+        Mixer::getInstance()->setPanning(channel, left, right);
+    else
+        Mix_SetPanning(channel, left, right);
+}
+
+void Voices::setChunkVolume(const VoiceGroup& group, int volume)
+{
+    if(group.id == 0)
+        return;
+
+    prune();
+
+    for(const int channel : m_active)
+    {
+        if(m_voices[channel].group == group.id && Mixer::isMixerChannel(channel))
+            Mixer::getInstance()->setChunkVolume(channel, volume);
+    }
+}
+
+void Voices::pauseAll()
+{
+    Mix_Pause(-1);
+    Mixer::getInstance()->pauseAll();
+}
+
+size_t Voices::getActiveCount()
+{
+    prune();
+    return m_active.size();
+}
+
+void Voices::prune()
+{
+    std::erase_if(m_active, [this](int channel)
+    {
+        if(isAlive(channel))
+            return false;
+
+        m_voices[channel].active = false;
+        return true;
+    });
+}
+
+bool Voices::makeRoom(const VoiceGroup& group, int priority)
+{
+    const size_t groupLimit = group.policy.m_maxVoices;
+    size_t groupCount = groupLimit == 0 ? 0 :
+                        static_cast<size_t>(std::count_if(m_active.begin(), m_active.end(),
+                                                          [this, &group](int channel) { return m_voices[channel].group == group.id; }));
+    size_t count = m_active.size();
+
+    // choose all the victims before stopping any, so that nothing is stolen for a voice that cannot start
+    std::vector<int> victims;
+
+    while(groupLimit > 0 && groupCount >= groupLimit)
+    {
+        const int victim = chooseVictim(group.id, priority, victims);
+        if(victim < 0)
+            return false;
+
+        // the voice of the group also makes room under the global limit
+        victims.push_back(victim);
+        groupCount--;
+        count--;
+    }
+
+    while(m_maxVoices > 0 && count >= m_maxVoices)
+    {
+        const int victim = chooseVictim(0, priority, victims);
+        if(victim < 0)
+            return false;
+
+        victims.push_back(victim);
+        count--;
+    }
+
+    for(const int victim : victims)
+        stop(victim);
+
+    return true;
+}
+
+int Voices::chooseVictim(uint64_t group, int priority, const std::vector<int>& excluded) const
+{
+    if(m_stealPolicy == VoiceManager::StealPolicy::None)
+        return -1;
+
+    int victim = -1;
+    int victimVolume = std::numeric_limits<int>::max();
+
+    for(const int channel : m_active)
+    {
+        const Voice& voice = m_voices[channel];
+        if((group != 0 && voice.group != group) || voice.priority > priority ||
+           std::find(excluded.begin(), excluded.end(), channel) != excluded.end())
+            continue;
+
+        if(victim < 0)
+        {
+            victim = channel;
+            if(m_stealPolicy == VoiceManager::StealPolicy::Quietest)
+                victimVolume = getVolume(channel) * voice.chunk->volume;
+            continue;
+        }
+
+        const Voice& current = m_voices[victim];
+        switch(m_stealPolicy)
+        {
+            case VoiceManager::StealPolicy::Oldest:
+                if(voice.start < current.start)
+                    victim = channel;
+                break;
+
+            case VoiceManager::StealPolicy::Quietest:
+            {
+                const int volume = getVolume(channel) * voice.chunk->volume;
+                if(volume < victimVolume)
+                {
+                    victim = channel;
+                    victimVolume = volume;
+                }
+                break;
+            }
+
+            case VoiceManager::StealPolicy::LowestPriority:
+                if(voice.priority < current.priority || (voice.priority == current.priority && voice.start < current.start))
+                    victim = channel;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    return victim;
+}
+
+void Voices::stop(int channel)
+{
+    m_voices[channel].active = false;
+    m_active.erase(std::find(m_active.begin(), m_active.end(), channel));
+
+    if(Mixer::isMixerChannel(channel))
+    {
+        Mixer::getInstance()->stop(channel);
+        return;
+    }
+
+    // the channel finished callback frees the channel
+    Mix_HaltChannel(channel);
+}
+
+int Voices::play(Mix_Chunk* chunk, int loops, int ticks)
+{
+    Mixer* mixer = Mixer::getInstance();
+    if(mixer->isInstalled())
+        return mixer->play(chunk, loops, ticks);
+
+    Channels* channels = Channels::getInstance();
+    const int channel = channels->reserve();
+    if(channel < 0)
+        return -1;
+
+    // the volume and panning of the channel may have been changed by its previous voice
+    Mix_Volume(channel, MIX_MAX_VOLUME);
+    Mix_SetPanning(channel, 255, 255);
+
+    if(Mix_PlayChannelTimed(channel, chunk, loops, ticks) < 0)
+    {
+        channels->free(channel);
+        return -1;
+    }
+
+    return channel;
+}
+
+bool Voices::isAlive(int channel) const
+{
+    if(Mixer::isMixerChannel(channel))
+        return Mixer::getInstance()->isActive(channel);
+
+    return Channels::getInstance()->isReserved(channel);
+}
+}
@@ -21,8 +21,7 @@
  */
 
 #include "iksdl/Window.hpp"
-#include <SDL_ttf.h>
-#include <SDL_mixer.h>
+#include "iksdl/Initializer.hpp"
 
 namespace iksdl
 {
@@ -33,20 +32,18 @@ Window::Window(const std::string& title, const Sizei& size, const WindowOptions&
 
 Window::Window(Window&& other) :
     Renderer(*other.m_window),
-    m_window(std::exchange(other.m_window, nullptr))
+    m_window(std::exchange(other.m_window, nullptr)),
+    m_windowId(other.m_windowId)
 {}
 
 Window::~Window()
 {
-    SDL_DestroyWindow(m_window);
-
-    // Destroy SDL context and image loaders if there is not more window
-    --windowsCount();
-    if(windowsCount() == 0)
+    // A moved window does not use the video anymore
+    if(m_window != nullptr)
     {
-        TTF_Quit();
-        IMG_Quit();
-        SDL_Quit();
+        priv::EventRouter::getInstance()->unregisterWindow(m_windowId);
+        SDL_DestroyWindow(m_window);
+        priv::Initializer::getInstance()->release(Subsystems::Type::Video);
     }
 }
 
@@ -55,8 +52,15 @@ Window& Window::operator=(Window&& other)
     if(this == &other)
         return *this;
 
-    SDL_DestroyWindow(m_window);
+    if(m_window != nullptr)
+    {
+        priv::EventRouter::getInstance()->unregisterWindow(m_windowId);
+        SDL_DestroyWindow(m_window);
+        priv::Initializer::getInstance()->release(Subsystems::Type::Video);
+    }
+
     m_window = std::exchange(other.m_window, nullptr);
+    m_windowId = other.m_windowId;
 
     return *this;
 }
@@ -66,38 +70,35 @@ Window::Window(SDL_Window& sdlWindow, const RendererOptions& rendererOptions) :
     m_window(&sdlWindow),
     m_windowId(SDL_GetWindowID(m_window))
 {
-    ++windowsCount();
+    priv::EventRouter::getInstance()->registerWindow(m_windowId);
 }
 
 SDL_Window* Window::createWindow(const std::string& title, const Sizei& size,
                                  const WindowOptions& options, const Positioni& position)
 {
-    // Initialize SDL context and image loaders
-    if(windowsCount() == 0)
-    {
-        if(SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO) < 0)
-            throw SdlException(std::string(CREATE_CONTEXT_ERROR) + SDL_GetError());
-
-        if(!(IMG_Init(IMG_LIBRARIES) & IMG_LIBRARIES))
-            throw SdlException(std::string(CREATE_IMAGE_LOADERS_ERROR) + IMG_GetError());
-
-        if(TTF_Init() < 0)
-            throw SdlException(std::string(CREATE_FONT_LOADERS_ERROR) + TTF_GetError());
-
-        if(Mix_OpenAudio(AUDIO_FREQUENCY, MIX_DEFAULT_FORMAT, MIX_DEFAULT_CHANNELS, AUDIO_CHUNK_SIZE) < 0)
-            throw SdlException(std::string(CREATE_AUDIO_LOADERS_ERROR) + Mix_GetError());
-    }
+    // Only the video is initialized here, the other subsystems are initialized when they are first needed
+    priv::Initializer* initializer = priv::Initializer::getInstance();
+    initializer->acquire(Subsystems::Type::Video);
 
     // Create window
     SDL_Window* window = SDL_CreateWindow(title.c_str(), position.getX(), position.getY(),
                                           size.getWidth(), size.getHeight(), options.m_sdlFlags);
 
     if(window == nullptr)
-        throw SdlException(std::string(CREATE_WINDOW_ERROR) + SDL_GetError());
+    {
+        const std::string error = SDL_GetError();
+        initializer->release(Subsystems::Type::Video);
+        throw SdlException(std::string(CREATE_WINDOW_ERROR) + error);
+    }
 
     return window;
 }
 
+void Window::setEventCoalescing(const EventCoalescing& coalescing)
+{
+    priv::EventRouter::getInstance()->setCoalescing(m_windowId, coalescing);
+}
+
 Positioni Window::getPosition() const
 {
     int x = 0, y = 0;